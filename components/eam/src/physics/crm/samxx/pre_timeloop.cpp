@@ -274,6 +274,9 @@ void pre_timeloop() {
     rhow(nz-1,icrm)= 2.0*rhow(nzm-1,icrm) - rhow(nzm-2,icrm);
   });
 
+  // Tridiagonal coefficients and Laplacian eigenvalues for the pressure solver
+  pressure_init();
+
   // Initialize clear air relative humidity for aerosol water uptake
   // for (int icrm=0; icrm<ncrms; icrm++) {
   //   for (int k=0; k<nzm; k++) {
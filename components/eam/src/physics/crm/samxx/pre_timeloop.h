@@ -11,6 +11,7 @@
 #include "accelerate_crm.h"
 #include "setperturb.h"
 #include "crm_variance_transport.h"
+#include "pressure.h"
 
 void pre_timeloop();
 
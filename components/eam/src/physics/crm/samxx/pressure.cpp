@@ -1,16 +1,57 @@
 
 #include "pressure.h"
 
-void pressure() {
-  YAKL_SCOPE( p             , :: p );
+void pressure_init() {
   YAKL_SCOPE( rhow          , :: rhow );
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( adzw          , :: adzw );
   YAKL_SCOPE( dz            , :: dz );
   YAKL_SCOPE( dx            , :: dx );
   YAKL_SCOPE( dy            , :: dy );
+  YAKL_SCOPE( ncrms         , :: ncrms );
+  YAKL_SCOPE( a             , :: press_a );
+  YAKL_SCOPE( c             , :: press_c );
+  YAKL_SCOPE( eign          , :: press_eign );
+
+  int nypp = RUN2D ? 1 : ny+2;
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
+    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
+  });
+
+  //   for (int j=0; j<nypp; j++) {
+  //     for (int i=0; i<nx+1; i++) {
+  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
+    int jt = 0;
+    int it = 0;
+
+    real ddx2=1.0/(dx*dx);
+    real ddy2=1.0/(dy*dy);
+    real pii = 3.14159265358979323846;
+    real xnx=pii/nx;
+    real xny=pii/ny;
+    int jd=((j+1)+jt-0.1)/2.0;
+    real facty = 2.0;
+    real xj=jd;
+    int id=((i+1)+it-0.1)/2.0;
+    real factx = 2.0;
+    real xi=id;
+    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
+  });
+}
+
+void pressure() {
+  YAKL_SCOPE( p             , :: p );
   YAKL_SCOPE( rho           , :: rho );
   YAKL_SCOPE( ncrms         , :: ncrms );
+  YAKL_SCOPE( f             , :: press_f );
+  YAKL_SCOPE( ff            , :: press_ff );
+  YAKL_SCOPE( a             , :: press_a );
+  YAKL_SCOPE( c             , :: press_c );
+  YAKL_SCOPE( eign          , :: press_eign );
 
   int npressureslabs = nsubdomains;
   int nzslab = max(1,nzm/npressureslabs); 
@@ -20,22 +61,7 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
-
-  int iwall = 0;
-  int nypp, jwall;
-
-  if (RUN2D) {
-    nypp = 1;
-    jwall = 0;
-  } else {
-    nypp = ny+2;
-  }
-
-  real2d eign("eign",nypp,nx+1);
+  int nypp = RUN2D ? 1 : ny+2;
 
   press_rhs();
 
@@ -101,33 +127,6 @@ void pressure() {
     ff(k,j,i,icrm) = f(k,j,i,icrm);
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
-    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
-  });
-
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
-    int jt = 0;
-    int it = 0;
-
-    real ddx2=1.0/(dx*dx);
-    real ddy2=1.0/(dy*dy);
-    real pii = 3.14159265358979323846;
-    real xnx=pii/nx;
-    real xny=pii/ny;
-    int jd=((j+1)+jt-0.1)/2.0;
-    real facty = 2.0;
-    real xj=jd;
-    int id=((i+1)+it-0.1)/2.0;
-    real factx = 2.0;
-    real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
-
   // for (int j=0; j<nypp; j++) {
   //  for (int i=0; i<nx+1; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
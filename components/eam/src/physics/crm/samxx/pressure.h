@@ -10,5 +10,8 @@
 extern "C" void fftfax_crm(int n, int *ifax, real *trigs);
 extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc, int jump, int n, int lot, int isign);
 
+// Precompute the parts of the pressure solve that are constant during the time loop
+void pressure_init();
+
 void pressure();
 
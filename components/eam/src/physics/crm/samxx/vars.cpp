@@ -192,6 +192,11 @@ void allocate() {
   t_vt_pert        = real4d( "t_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
   q_vt_pert        = real4d( "q_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
   u_vt_pert        = real4d( "u_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
+  press_f          = real4d( "press_f        "     , max(1,nzm/nsubdomains) , nyp2 , nx+2 , ncrms );
+  press_ff         = real4d( "press_ff       "     , nzm , nyp2       , nx+1   , ncrms );
+  press_a          = real2d( "press_a        "                        , nzm    , ncrms );
+  press_c          = real2d( "press_c        "                        , nzm    , ncrms );
+  press_eign       = real2d( "press_eign     "     , RUN2D ? 1 : ny+2 , nx+1            );
 
   yakl::memset(t00               ,0.);
   yakl::memset(tln               ,0.);
@@ -666,6 +671,11 @@ void finalize() {
   t_vt_pert        = real4d();
   q_vt_pert        = real4d();
   u_vt_pert        = real4d();
+  press_f          = real4d();
+  press_ff         = real4d();
+  press_a          = real2d();
+  press_c          = real2d();
+  press_eign       = real2d();
 
   yakl::fence();
 
@@ -1626,6 +1636,11 @@ real2d u_vt_tend      ;
 real4d t_vt_pert      ;
 real4d q_vt_pert      ;
 real4d u_vt_pert      ;
+real4d press_f        ;
+real4d press_ff       ;
+real2d press_a        ;
+real2d press_c        ;
+real2d press_eign     ;
 
 real1d fcorz           ;
 real1d fcor            ;
@@ -337,6 +337,14 @@ extern real4d t_vt_pert      ;
 extern real4d q_vt_pert      ;
 extern real4d u_vt_pert      ;
 
+// Pressure solver workspace. The tridiagonal coefficients and the eigenvalues
+// of the horizontal Laplacian only change in pre_timeloop (see pressure_init)
+extern real4d press_f        ;
+extern real4d press_ff       ;
+extern real2d press_a        ;
+extern real2d press_c        ;
+extern real2d press_eign     ;
+
 extern real1d fcorz           ;
 extern real1d fcor            ;
 extern real1d longitude0      ;
@@ -1,9 +1,10 @@
 #include "diagnostics/field_at_pressure_level.hpp"
-#include "share/util/scream_vertical_interpolation.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_units.hpp"
 
+#include <map>
+
 namespace scream
 {
 
@@ -63,9 +64,6 @@ FieldAtPressureLevel (const ekat::Comm& comm, const ekat::ParameterList& params)
     m_pressure_level *= 100;
   }
 
-  m_p_tgt = view_1d<Pack1>("",1);
-  Kokkos::deep_copy(m_p_tgt, m_pressure_level);
-
   m_mask_val = m_params.get<double>("mask_value",Real(std::numeric_limits<float>::max()/10.0));
 
   // Create request for pressure field
@@ -75,13 +73,10 @@ FieldAtPressureLevel (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_num_levs = layout.dims().back();
   auto num_cols = layout.dims().front();
 
-  // Take care of mask tracking for this field, in case it is needed.  This has two steps:
-  //   1.  We need to actually track the masked columns, so we create a 2d (COL only) field.
-  //       NOTE: Here we assume that even a source field of rank 3+ will be masked the same
+  // Take care of mask tracking for this field, in case it is needed. We need to track the
+  // masked columns, so we create a 2d (COL only) field, which is set from the interp plan.
+  // NOTE: Here we assume that even a source field of rank 3+ will be masked the same
   //       across all components so the mask is represented by a column-wise slice.
-  //   2.  We also need to create a helper field that may be used w/ the vertical remapper to set
-  //       the mask.  This field is 3d (COLxLEV) to mimic the type of interpolation that is
-  //       being conducted on the source field.
 
   // Add a field representing the mask as extra data to the diagnostic field.
   auto nondim = ekat::units::Units::nondimensional();
@@ -92,63 +87,156 @@ FieldAtPressureLevel (const ekat::Comm& comm, const ekat::ParameterList& params)
   diag_mask.allocate_view();
   m_diagnostic_output.get_header().set_extra_data("mask_data",diag_mask);
   m_diagnostic_output.get_header().set_extra_data("mask_value",m_mask_val);
+}
+
+// =========================================================================================
+std::shared_ptr<FieldAtPressureLevel::InterpPlan>
+FieldAtPressureLevel::get_interp_plan (const Field& pressure, const Real p_tgt)
+{
+  // The interpolation needs a bracketing pair of levels
+  const auto& layout = pressure.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (layout.dims().back()>=2,
+      "Error! FieldAtPressureLevel requires at least two vertical levels.\n"
+      " - pressure name  : " + pressure.name() + "\n"
+      " - pressure layout: " + to_string(layout) + "\n");
+
+  // Plans are only held by the diagnostics using them. Once all of them are gone,
+  // the plan is destroyed, and the entry in the map expires. Expired entries are
+  // removed here, so the map does not grow with diagnostics that no longer exist.
+  using key_t = std::pair<const FieldHeader*,Real>;
+  static std::map<key_t,std::weak_ptr<InterpPlan>> plans;
+  for (auto it=plans.begin(); it!=plans.end(); ) {
+    if (it->second.expired()) {
+      it = plans.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  const key_t key (pressure.get_header_ptr().get(),p_tgt);
+  auto plan = plans[key].lock();
+  if (not plan) {
+    const int ncols = layout.dims().front();
+
+    plan = std::make_shared<InterpPlan>();
+    plan->pressure = pressure;
+    plan->p_tgt    = p_tgt;
+    plan->lev      = view_1d<int>("lev",ncols);
+    plan->dp_tgt   = view_1d<Real>("dp_tgt",ncols);
+    plan->dp_lev   = view_1d<Real>("dp_lev",ncols);
+    plans[key] = plan;
+  }
+  return plan;
+}
 
-  // Allocate helper views
-  FieldLayout mask_src_layout( {COL, LEV}, {num_cols, m_num_levs});
-  FieldIdentifier mask_src_fid ("mask_tmp",mask_src_layout, nondim, gname);
-  m_mask_field = Field(mask_src_fid);
-  m_mask_field.allocate_view();
+// =========================================================================================
+void FieldAtPressureLevel::InterpPlan::update ()
+{
+  // If pressure has not changed since last time, the plan is still valid
+  const auto& ts = pressure.get_header().get_tracking().get_time_stamp();
+  if (ts.is_valid() and ts==time_stamp) {
+    return;
+  }
+  time_stamp = ts;
+
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto& layout = pressure.get_header().get_identifier().get_layout();
+  const int ncols = layout.dims().front();
+  const int nlevs = layout.dims().back();
+  const auto p = pressure.get_view<const Real**>();
+  const auto tgt = p_tgt;
+  const auto plev = lev;
+  const auto dpt  = dp_tgt;
+  const auto dpl  = dp_lev;
+  Kokkos::parallel_for("FieldAtPressureLevel::InterpPlan::update",RangePolicy(0,ncols),
+                       KOKKOS_LAMBDA(const int icol) {
+    // Pressure increases with the level index. Mask values outside the column range.
+    if (tgt<p(icol,0) or tgt>p(icol,nlevs-1)) {
+      plev(icol) = -1;
+      dpt(icol) = 0;
+      dpl(icol) = 1;
+      return;
+    }
+
+    // Bisection for the last level k<nlevs-1 such that p(k)<=tgt
+    int beg = 0, end = nlevs-1;
+    while (end-beg>1) {
+      const int mid = (beg+end)/2;
+      if (p(icol,mid)<=tgt) {
+        beg = mid;
+      } else {
+        end = mid;
+      }
+    }
+    plev(icol) = beg;
+    dpt(icol) = tgt - p(icol,beg);
+    dpl(icol) = p(icol,beg+1) - p(icol,beg);
+  });
 }
 
 // =========================================================================================
 void FieldAtPressureLevel::compute_diagnostic_impl()
 {
-  using namespace scream::vinterp;
+  using RangePolicy = typename KT::RangePolicy;
 
-  //This is 2D source pressure
-  const Field& pressure_f = get_field_in(m_pressure_name);
-  const auto pressure = pressure_f.get_view<const Pack1**>();
-  view_Nd<const Pack1,2> pres(pressure.data(),pressure.extent_int(0),pressure.extent_int(1));
-  // Kokkos::deep_copy(pres,pressure);
+  if (not m_plan) {
+    m_plan = get_interp_plan(get_field_in(m_pressure_name),m_pressure_level);
+  }
+  m_plan->update();
 
-  const Field& f = get_field_in(m_field_name);
+  const auto lev    = m_plan->lev;
+  const auto dp_tgt = m_plan->dp_tgt;
+  const auto dp_lev = m_plan->dp_lev;
+  const auto mask_val = m_mask_val;
+
+  // The mask comes straight from the plan
+  auto extra_data = m_diagnostic_output.get_header().get_extra_data().at("mask_data");
+  auto d_mask     = ekat::any_cast<Field>(extra_data);
+  auto mask_v     = d_mask.get_view<Real*>();
 
-  // The setup for interpolation varies depending on the rank of the input field:
-  const int rank = f.rank();
-
-  m_mask_field.deep_copy(1.0);
-  auto mask_v_tmp = m_mask_field.get_view<Pack1**>();
-  if (rank==2) {
-    const auto f_data_src = f.get_view<const Pack1**>();
-    //output field on new grid
-    auto d_data_tgt = m_diagnostic_output.get_view<Pack1*>();
-    view_Nd<Pack1,2> data_tgt_tmp(d_data_tgt.data(),d_data_tgt.extent_int(0),1);  // Note, vertical interp wants a 2D view, so we create a temporary one
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,f_data_src,data_tgt_tmp,m_num_levs,1,m_mask_val);
-
-    // Track mask
-    auto extra_data = m_diagnostic_output.get_header().get_extra_data().at("mask_data");
-    auto d_mask     = ekat::any_cast<Field>(extra_data);
-    auto d_mask_tgt = d_mask.get_view<Pack1*>();
-    view_Nd<Pack1,2> mask_tgt_tmp(d_mask_tgt.data(),d_mask_tgt.extent_int(0),1);  
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,mask_v_tmp,mask_tgt_tmp,m_num_levs,1,0);
-  } else if (rank==3) {
-    const auto f_data_src = f.get_view<const Pack1***>();
-    //output field on new grid
-    auto d_data_tgt = m_diagnostic_output.get_view<Pack1**>();
-    view_Nd<Pack1,3> data_tgt_tmp(d_data_tgt.data(),d_data_tgt.extent_int(0),d_data_tgt.extent_int(1),1);  
-
-    perform_vertical_interpolation<Real,1,3>(pres,m_p_tgt,f_data_src,data_tgt_tmp,m_num_levs,1,m_mask_val);
-
-    // Track mask
-    auto extra_data = m_diagnostic_output.get_header().get_extra_data().at("mask_data");
-    auto d_mask     = ekat::any_cast<Field>(extra_data);
-    auto d_mask_tgt = d_mask.get_view<Pack1*>();
-    view_Nd<Pack1,2> mask_tgt_tmp(d_mask_tgt.data(),d_mask_tgt.extent_int(0),1);  
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,mask_v_tmp,mask_tgt_tmp,m_num_levs,1,0);
+  const Field& f = get_field_in(m_field_name);
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const int ncols = fl.dims().front();
+  if (fl.rank()==2) {
+    const auto f_v = f.get_view<const Real**>();
+    const auto d_v = m_diagnostic_output.get_view<Real*>();
+    Kokkos::parallel_for(m_diagnostic_output.name(),RangePolicy(0,ncols),
+                         KOKKOS_LAMBDA(const int icol) {
+      const int k = lev(icol);
+      if (k<0) {
+        d_v(icol) = mask_val;
+        mask_v(icol) = 0;
+      } else {
+        const auto f0 = f_v(icol,k);
+        const auto f1 = f_v(icol,k+1);
+        d_v(icol) = f0 + (f1-f0)*dp_tgt(icol)/dp_lev(icol);
+        mask_v(icol) = 1;
+      }
+    });
+  } else if (fl.rank()==3) {
+    const int ncmps = fl.dims()[1];
+    const auto f_v = f.get_view<const Real***>();
+    const auto d_v = m_diagnostic_output.get_view<Real**>();
+    Kokkos::parallel_for(m_diagnostic_output.name(),RangePolicy(0,ncols*ncmps),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / ncmps;
+      const int icmp = idx % ncmps;
+      const int k = lev(icol);
+      if (k<0) {
+        d_v(icol,icmp) = mask_val;
+      } else {
+        const auto f0 = f_v(icol,icmp,k);
+        const auto f1 = f_v(icol,icmp,k+1);
+        d_v(icol,icmp) = f0 + (f1-f0)*dp_tgt(icol)/dp_lev(icol);
+      }
+      if (icmp==0) {
+        mask_v(icol) = k<0 ? 0 : 1;
+      }
+    });
   } else {
     EKAT_ERROR_MSG("Error! field at pressure level only supports fields ranks 2 and 3 \n");
   }
-
 }
 
 } //namespace scream
@@ -3,7 +3,7 @@
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
-#include <ekat/ekat_pack.hpp>
+#include <memory>
 
 namespace scream
 {
@@ -31,6 +31,26 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> /* grids_manager */) {}
 
+  // Interpolation plan for a (pressure field, pressure level) pair. For each column,
+  // it stores the index of the last source level with pressure below the target,
+  // together with the coefficients of the linear interpolation. All diagnostics
+  // slicing fields at the same pressure level share the same plan, which is only
+  // recomputed when the time stamp of the pressure field changes.
+  struct InterpPlan {
+    Field               pressure;
+    Real                p_tgt;
+    util::TimeStamp     time_stamp;
+
+    view_1d<int>        lev;    // -1 if p_tgt is outside the column pressure range
+    view_1d<Real>       dp_tgt; // p_tgt - p(lev)
+    view_1d<Real>       dp_lev; // p(lev+1) - p(lev)
+
+    void update ();
+  };
+
+  static std::shared_ptr<InterpPlan>
+  get_interp_plan (const Field& pressure, const Real p_tgt);
+
 protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
@@ -38,13 +58,10 @@ public:
   void compute_diagnostic_impl ();
 protected:
 
-  using Pack1 = ekat::Pack<Real,1>;
-
   std::string         m_pressure_name;
   std::string         m_field_name;
 
-  view_1d<Pack1>      m_p_tgt;
-  Field               m_mask_field;
+  std::shared_ptr<InterpPlan> m_plan;
   Real                m_pressure_level;
   int                 m_num_levs;
   Real                m_mask_val;
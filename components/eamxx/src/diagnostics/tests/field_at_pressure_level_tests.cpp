@@ -139,6 +139,37 @@ TEST_CASE("field_at_pressure_level_p2")
       }
     }
   } 
+  {
+    // Test 4: Diagnostics at the same pressure level share the interpolation plan
+    Real plevel = std::round(pdf_pmid(engine));
+    auto diag_mid = get_test_diag(comm, fm, gm, "mid", plevel);
+    diag_mid->initialize(t0,RunType::Initial);
+    diag_mid->compute_diagnostic();
+
+    const auto& p_mid = fm->get_field("p_mid");
+    auto plan = FieldAtPressureLevel::get_interp_plan(p_mid,plevel);
+    REQUIRE (plan==FieldAtPressureLevel::get_interp_plan(p_mid,plevel));
+    REQUIRE (plan!=FieldAtPressureLevel::get_interp_plan(p_mid,plevel+1));
+    REQUIRE (plan!=FieldAtPressureLevel::get_interp_plan(fm->get_field("p_int"),plevel));
+
+    // The plan was already computed by the diagnostic, for all columns
+    auto lev_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),plan->lev);
+    auto p_mid_h = p_mid.get_view<const Real**,Host>();
+    for (int icol=0;icol<ncols;icol++) {
+      const int k = lev_h(icol);
+      REQUIRE ((k>=0 && k<nlevs-1));
+      REQUIRE (p_mid_h(icol,k)<=plevel);
+      REQUIRE (p_mid_h(icol,k+1)>=plevel);
+    }
+  }
+  {
+    // Test 5: A single level has no bracketing pair of levels to interpolate from
+    using namespace ShortFieldTagsNames;
+    FieldIdentifier fid ("p_one_lev",FieldLayout({COL,LEV},{ncols,1}),ekat::units::Pa,grid->name());
+    Field p_one_lev(fid);
+    p_one_lev.allocate_view();
+    REQUIRE_THROWS (FieldAtPressureLevel::get_interp_plan(p_one_lev,pdf_pmid(engine)));
+  }
   
 } // TEST_CASE("field_at_pressure_level")
 /*==========================================================================================================*/
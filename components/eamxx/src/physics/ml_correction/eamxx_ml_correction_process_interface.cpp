@@ -39,7 +39,7 @@ void MLCorrection::set_grids(
   add_field<Required>("qv", scalar3d_layout_mid, Q, grid_name, "tracers");
 
   // Set of fields used strictly as output
-  add_field<Computed>("qv_nudging_tend", scalar3d_layout_mid, Q, grid_name);
+  add_field<Computed>("qv_nudging_tend", scalar3d_layout_mid, Q / s, grid_name);
 
   // Set of fields used as input and output
   // - There are no fields used as both input and output.
@@ -47,15 +47,26 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  // Nothing to do
+  // Load the network, and check it maps a qv column to a qv tendency column
+  const auto model_path = m_params.get<std::string>("ml_model_path");
+  m_nn.read(model_path, m_comm);
+  EKAT_REQUIRE_MSG(m_nn.num_inputs() == m_num_levs and
+                       m_nn.num_outputs() == m_num_levs,
+                   "Error! The ML correction network does not match the number of levels.\n"
+                   "  - model file: " + model_path + "\n"
+                   "  - network inputs/outputs: " + std::to_string(m_nn.num_inputs()) +
+                       "/" + std::to_string(m_nn.num_outputs()) + "\n"
+                   "  - number of levels: " + std::to_string(m_num_levs) + "\n");
+  m_nn.setup_work_space(m_num_cols);
 }
 
 // =========================================================================================
 void MLCorrection::run_impl(const double /* dt */) {
-  auto qv         = get_field_in("qv").get_view<const Real **>();
-  auto qv_nudging = get_field_out("qv_nudging").get_view<Real **>();
+  auto qv              = get_field_in("qv").get_view<const Real **>();
+  auto qv_nudging_tend = get_field_out("qv_nudging_tend").get_view<Real **>();
 
-  // ML correction proceess is not yet implemented
+  // Evaluate the network on all columns at once
+  m_nn.apply(qv, qv_nudging_tend);
 }
 
 // =========================================================================================
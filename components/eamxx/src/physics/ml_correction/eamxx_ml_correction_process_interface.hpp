@@ -4,13 +4,18 @@
 #include <string>
 
 #include "ekat/ekat_parameter_list.hpp"
+#include "physics/ml_correction/ml_correction_nn.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 
 namespace scream {
 
 /*
- * The class responsible to handle the calculation of the subgrid cloud
- * fractions
+ * The class responsible to compute the ML correction of the qv tendency.
+ *
+ * The correction is computed in-process by a small feed-forward network
+ * (see MLCorrectionNN), mapping the qv profile of a column to its tendency.
+ * The network weights are read from the file given by the 'ml_model_path'
+ * parameter.
  *
  * The AD should store exactly ONE instance of this class stored
  * in its list of subcomponents (the AD should make sure of this).
@@ -40,6 +45,9 @@ class MLCorrection : public AtmosphereProcess {
   Int m_num_cols;
   Int m_num_levs;
 
+  // The network computing the correction
+  MLCorrectionNN m_nn;
+
   std::shared_ptr<const AbstractGrid> m_grid;
 };  // class MLCorrection
 
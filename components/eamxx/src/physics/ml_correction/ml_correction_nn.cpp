@@ -0,0 +1,195 @@
+#include "ml_correction_nn.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "share/util/scream_utils.hpp"
+
+namespace scream {
+
+namespace {
+
+// Parse the weights file. Returns an error message, empty on success.
+std::string parse_nn_file(const std::string &filename, std::vector<int> &meta,
+                          std::vector<Real> &params) {
+  std::ifstream in(filename);
+  if(not in.good()) {
+    return "Could not open file '" + filename + "'.";
+  }
+
+  std::string magic;
+  int version = -1, nlayers = 0;
+  in >> magic >> version >> nlayers;
+  if(in.fail() or magic != "MLCORRECTION_NN") {
+    return "Bad header in '" + filename + "', expected 'MLCORRECTION_NN <version>'.";
+  }
+  if(version != MLCorrectionNN::format_version) {
+    return "Unsupported format version " + std::to_string(version) + " in '" +
+           filename + "', expected " +
+           std::to_string(MLCorrectionNN::format_version) + ".";
+  }
+  if(nlayers <= 0) {
+    return "Bad number of layers in '" + filename + "'.";
+  }
+
+  for(int l = 0; l < nlayers; ++l) {
+    int         nin = 0, nout = 0;
+    std::string act_str;
+    in >> nin >> nout >> act_str;
+    const std::string where =
+        " for layer " + std::to_string(l) + " in '" + filename + "'.";
+    if(in.fail() or nin <= 0 or nout <= 0) {
+      return "Bad layer sizes" + where;
+    }
+    if(l > 0 and nin != meta[4 * (l - 1) + 1]) {
+      return "Number of inputs does not match the previous layer outputs" +
+             where;
+    }
+    int act;
+    if(act_str == "linear") {
+      act = MLCorrectionNN::Linear;
+    } else if(act_str == "relu") {
+      act = MLCorrectionNN::ReLU;
+    } else if(act_str == "tanh") {
+      act = MLCorrectionNN::Tanh;
+    } else {
+      return "Unsupported activation '" + act_str + "'" + where;
+    }
+    meta.insert(meta.end(), {nin, nout, act, static_cast<int>(params.size())});
+
+    const int n = nout * nin + nout;
+    double    val;  // double, to stream correctly regardless of Real
+    for(int i = 0; i < n; ++i) {
+      in >> val;
+      params.push_back(val);
+    }
+    if(in.fail()) {
+      return "Could not read the weights and biases" + where;
+    }
+  }
+  return "";
+}
+
+}  // anonymous namespace
+
+// =========================================================================================
+void MLCorrectionNN::read(const std::string &filename,
+                          const ekat::Comm &comm) {
+  std::vector<int>  meta;
+  std::vector<Real> params;
+  std::string       err;
+  if(comm.am_i_root()) {
+    err = parse_nn_file(filename, meta, params);
+  }
+
+  // Make sure all ranks throw if root failed to read the file
+  broadcast_string(err, comm, comm.root_rank());
+  EKAT_REQUIRE_MSG(err.empty(),
+                   "Error! Could not read the ML correction network.\n"
+                   "  - " + err + "\n");
+
+  int sizes[2] = {static_cast<int>(meta.size()),
+                  static_cast<int>(params.size())};
+  comm.broadcast(sizes, 2, comm.root_rank());
+  meta.resize(sizes[0]);
+  params.resize(sizes[1]);
+  comm.broadcast(meta.data(), sizes[0], comm.root_rank());
+  comm.broadcast(params.data(), sizes[1], comm.root_rank());
+
+  const int nlayers = meta.size() / 4;
+  m_num_in.resize(nlayers);
+  m_num_out.resize(nlayers);
+  m_max_width = 0;
+  for(int l = 0; l < nlayers; ++l) {
+    m_num_in[l]  = meta[4 * l];
+    m_num_out[l] = meta[4 * l + 1];
+    // The last layer writes directly to the output
+    if(l < nlayers - 1) {
+      m_max_width = std::max(m_max_width, m_num_out[l]);
+    }
+  }
+
+  m_layers = view_2d<int>("MLCorrectionNN::layers", nlayers, 4);
+  m_params = view_1d<Real>("MLCorrectionNN::params", params.size());
+  auto layers_h = Kokkos::create_mirror_view(m_layers);
+  auto params_h = Kokkos::create_mirror_view(m_params);
+  std::copy(meta.begin(), meta.end(), layers_h.data());
+  std::copy(params.begin(), params.end(), params_h.data());
+  Kokkos::deep_copy(m_layers, layers_h);
+  Kokkos::deep_copy(m_params, params_h);
+}
+
+// =========================================================================================
+void MLCorrectionNN::setup_work_space(const int ncols) {
+  EKAT_REQUIRE_MSG(num_layers() > 0,
+                   "Error! MLCorrectionNN::setup_work_space called before "
+                   "reading the network.\n");
+  m_work = view_3d<Real>("MLCorrectionNN::work", ncols, 2, std::max(m_max_width, 1));
+}
+
+// =========================================================================================
+void MLCorrectionNN::apply(const view_2d<const Real> &x,
+                           const view_2d<Real> &y) const {
+  const int ncols   = x.extent(0);
+  const int nlayers = num_layers();
+  EKAT_REQUIRE_MSG(x.extent_int(1) == num_inputs() and
+                       y.extent_int(1) == num_outputs() and
+                       y.extent_int(0) == ncols,
+                   "Error! Incompatible input/output sizes in MLCorrectionNN::apply.\n"
+                   "  - network inputs/outputs: " + std::to_string(num_inputs()) +
+                       "/" + std::to_string(num_outputs()) + "\n"
+                   "  - x: (" + std::to_string(x.extent(0)) + "," + std::to_string(x.extent(1)) + ")\n"
+                   "  - y: (" + std::to_string(y.extent(0)) + "," + std::to_string(y.extent(1)) + ")\n");
+  EKAT_REQUIRE_MSG(m_work.extent_int(0) >= ncols,
+                   "Error! MLCorrectionNN work space is too small.\n"
+                   "  - work space columns: " + std::to_string(m_work.extent(0)) + "\n"
+                   "  - input columns: " + std::to_string(ncols) + "\n");
+
+  const auto layers = m_layers;
+  const auto params = m_params;
+  const auto work   = m_work;
+
+  const int  max_width = std::max(m_max_width, num_outputs());
+  const auto policy =
+      ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncols, max_width);
+  Kokkos::parallel_for(
+      "MLCorrectionNN::apply", policy, KOKKOS_LAMBDA(const MemberType &team) {
+        const int icol = team.league_rank();
+        for(int l = 0; l < nlayers; ++l) {
+          const int nin  = layers(l, 0);
+          const int nout = layers(l, 1);
+          const int act  = layers(l, 2);
+          const int woff = layers(l, 3);
+          const int boff = woff + nin * nout;
+
+          // Layers alternate between the two work slots. The first layer reads
+          // x, and the last one writes y.
+          const Real *in = l == 0 ? &x(icol, 0) : &work(icol, (l + 1) % 2, 0);
+          Real *out = l == nlayers - 1 ? &y(icol, 0) : &work(icol, l % 2, 0);
+
+          Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, nout), [&](const int j) {
+                const Real *w_j = &params(woff + j * nin);
+                Real        val = 0;
+                Kokkos::parallel_reduce(
+                    Kokkos::ThreadVectorRange(team, nin),
+                    [&](const int k, Real &sum) { sum += w_j[k] * in[k]; },
+                    val);
+                val += params(boff + j);
+                if(act == ReLU) {
+                  val = val > 0 ? val : 0;
+                } else if(act == Tanh) {
+                  val = Kokkos::tanh(val);
+                }
+                Kokkos::single(Kokkos::PerThread(team), [&]() { out[j] = val; });
+              });
+          // The next layer reads all the outputs of this one
+          team.team_barrier();
+        }
+      });
+  Kokkos::fence();
+}
+
+}  // namespace scream
@@ -0,0 +1,81 @@
+#ifndef SCREAM_ML_CORRECTION_NN_HPP
+#define SCREAM_ML_CORRECTION_NN_HPP
+
+#include <string>
+#include <vector>
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "share/scream_types.hpp"
+
+namespace scream {
+
+/*
+ * A small dense feed-forward network, evaluated in-process on device.
+ *
+ * The network is a sequence of dense layers, y = act(W*x + b), read from a
+ * plain text file with the following (whitespace separated) format:
+ *
+ *   MLCORRECTION_NN <format version>
+ *   <number of layers>
+ *   for each layer:
+ *     <number of inputs> <number of outputs> <activation: linear, relu or tanh>
+ *     W, one row per output (each row has one value per input)
+ *     b, one value per output
+ *
+ * Any affine normalization of inputs and outputs can be folded into the
+ * first and last layer, respectively.
+ *
+ * The network is applied to all columns in a single kernel, with one team
+ * per column. Each layer is a team-parallel loop over outputs, and a vector
+ * reduction over the (contiguous) inputs.
+ */
+
+class MLCorrectionNN {
+ public:
+  using KT         = KokkosTypes<DefaultDevice>;
+  using MemberType = KT::MemberType;
+
+  template <typename T>
+  using view_1d = KT::view_1d<T>;
+  template <typename T>
+  using view_2d = KT::view_2d<T>;
+  template <typename T>
+  using view_3d = KT::view_3d<T>;
+
+  enum Activation : int { Linear = 0, ReLU = 1, Tanh = 2 };
+
+  static constexpr int format_version = 1;
+
+  // Read the network on the root rank of comm, and broadcast it
+  void read(const std::string &filename, const ekat::Comm &comm);
+
+  int num_layers() const { return m_num_in.size(); }
+  int num_inputs() const { return m_num_in.front(); }
+  int num_outputs() const { return m_num_out.back(); }
+
+  // Allocate work space for the hidden layers of up to ncols columns
+  void setup_work_space(const int ncols);
+
+  // y(icol,:) = network(x(icol,:)), for all columns of x.
+  // Must be public, since it contains a device lambda.
+  void apply(const view_2d<const Real> &x, const view_2d<Real> &y) const;
+
+ protected:
+  // Layer sizes (on host, for checks)
+  std::vector<int> m_num_in;
+  std::vector<int> m_num_out;
+  int              m_max_width = 0;
+
+  // For each layer: num inputs, num outputs, activation, offset of W in m_params.
+  // b follows W in m_params.
+  view_2d<int>  m_layers;
+  view_1d<Real> m_params;
+
+  // Outputs of the hidden layers, (col, 2, max width): layers alternate
+  // between the two slots
+  view_3d<Real> m_work;
+};
+
+}  // namespace scream
+
+#endif  // SCREAM_ML_CORRECTION_NN_HPP
@@ -47,6 +47,11 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = m_params.get<bool>("do_predict_nc",true);
   infrastructure.prescribedCCN = m_params.get<bool>("do_prescribed_ccn",true);
+  infrastructure.compact_active_columns = m_params.get<bool>("compact_active_columns",false);
+  if (infrastructure.compact_active_columns) {
+    infrastructure.has_work  = P3F::view_1d<bool>("has_work", m_num_cols);
+    infrastructure.col_order = P3F::view_1d<Int>("col_order", m_num_cols);
+  }
 
   // Define the different field layouts that will be used for this process
   using namespace ShortFieldTagsNames;
@@ -328,8 +333,11 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
     p3_postproc.set_mass_and_energy_fluxes(vapor_flux, water_flux, ice_flux, heat_flux);
   }
 
-  // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  // Load tables. Only the root rank reads the ice table from file. If a cache dir is
+  // given, the parsed ice table is cached there, to skip the parsing in later runs.
+  const auto ice_table_cache_dir = m_params.get<std::string>("ice_table_cache_dir","");
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals,
+                                     m_comm, ice_table_cache_dir);
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
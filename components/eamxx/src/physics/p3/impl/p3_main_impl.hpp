@@ -69,6 +69,126 @@ void Functions<S,D>
   team.team_barrier();
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+bool Functions<S,D>
+::p3_main_column_has_work(
+  const MemberType& team,
+  const Int& nk,
+  const uview_1d<const Spack>& pres,
+  const uview_1d<const Spack>& inv_exner,
+  const uview_1d<const Spack>& th_atm,
+  const uview_1d<const Spack>& qv,
+  const uview_1d<const Spack>& qc,
+  const uview_1d<const Spack>& qr,
+  const uview_1d<const Spack>& qi)
+{
+  // Get access to saturation functions
+  using physics = scream::physics::Functions<Scalar, Device>;
+
+  constexpr Scalar T_zerodegc = C::T_zerodegc;
+  constexpr Scalar qsmall     = C::QSMALL;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+
+  // NOTE: these must be the *same* conditions (and the same operations) used in
+  //       p3_main_init and p3_main_part1 to set nucleationPossible/hydrometeorsPresent
+  Int num_wet_packs = 0;
+  Kokkos::parallel_reduce(
+    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k, Int& num_wet) {
+
+    const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+    const auto range_mask = range_pack < nk;
+
+    const Spack exner = 1 / inv_exner(k);
+    const Spack T_atm = th_atm(k) * exner;
+    const Spack qv_k  = max(qv(k), 0);
+    const Spack qv_sat_i = physics::qv_sat_dry(T_atm, pres(k), true, range_mask, physics::MurphyKoop, "p3::p3_main_column_has_work (ice)");
+    const Spack qv_supersat_i = qv_k / qv_sat_i - 1;
+
+    const auto nucleation = T_atm < T_zerodegc && qv_supersat_i >= -0.05;
+    const auto wet_qc = !(qc(k) < qsmall) && range_mask;
+    const auto wet_qr = !(qr(k) < qsmall) && range_mask;
+    const auto wet_qi = !(qi(k) < qsmall || (qi(k) < 1.e-8 && qv_supersat_i < -0.1)) && range_mask;
+    if (nucleation.any() || wet_qc.any() || wet_qr.any() || wet_qi.any()) {
+      ++num_wet;
+    }
+  }, num_wet_packs);
+
+  return num_wet_packs>0;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::p3_main_dry_column(
+  const MemberType& team,
+  const Int& nk,
+  const uview_1d<const Spack>& inv_exner,
+  const uview_1d<const Spack>& latent_heat_vapor,
+  const uview_1d<const Spack>& latent_heat_sublim,
+  const uview_1d<Spack>& qv,
+  const uview_1d<Spack>& th_atm,
+  const uview_1d<Spack>& qc,
+  const uview_1d<Spack>& nc,
+  const uview_1d<Spack>& qr,
+  const uview_1d<Spack>& nr,
+  const uview_1d<Spack>& qi,
+  const uview_1d<Spack>& ni,
+  const uview_1d<Spack>& qm,
+  const uview_1d<Spack>& bm,
+  const uview_1d<Spack>& diag_eff_radius_qc,
+  const uview_1d<Spack>& diag_eff_radius_qi,
+  const uview_1d<Spack>& rho_qi,
+  const uview_1d<Spack>& qv2qi_depos_tend,
+  const uview_1d<Spack>& precip_liq_flux,
+  const uview_1d<Spack>& precip_ice_flux,
+  Scalar& precip_liq_surf,
+  Scalar& precip_ice_surf)
+{
+  constexpr Scalar inv_cp = C::INV_CP;
+
+  precip_liq_surf = 0;
+  precip_ice_surf = 0;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+
+    const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+    const auto range_mask = range_pack < nk;
+
+    // From p3_main_init
+    diag_eff_radius_qc(k) = 10.e-6;
+    diag_eff_radius_qi(k) = 25.e-6;
+    rho_qi(k)             = 0;
+    qv2qi_depos_tend(k)   = 0;
+    precip_liq_flux(k)    = 0;
+    precip_ice_flux(k)    = 0;
+    qv(k)                 = max(qv(k), 0);
+
+    // From p3_main_part1: since the column is dry, all of qc, qr, and qi
+    // are below the thresholds, and are clipped at every level
+    qv(k).set(range_mask, qv(k) + qc(k));
+    th_atm(k).set(range_mask, th_atm(k) - inv_exner(k) * qc(k) * latent_heat_vapor(k) * inv_cp);
+    qc(k).set(range_mask, 0);
+    nc(k).set(range_mask, 0);
+
+    qv(k).set(range_mask, qv(k) + qr(k));
+    th_atm(k).set(range_mask, th_atm(k) - inv_exner(k) * qr(k) * latent_heat_vapor(k) * inv_cp);
+    qr(k).set(range_mask, 0);
+    nr(k).set(range_mask, 0);
+
+    qv(k).set(range_mask, qv(k) + qi(k));
+    th_atm(k).set(range_mask, th_atm(k) - inv_exner(k) * qi(k) * latent_heat_sublim(k) * inv_cp);
+    qi(k).set(range_mask, 0);
+    ni(k).set(range_mask, 0);
+    qm(k).set(range_mask, 0);
+    bm(k).set(range_mask, 0);
+  });
+  team.team_barrier();
+}
+
 template <typename S, typename D>
 Int Functions<S,D>
 ::p3_main(
@@ -104,13 +224,98 @@ Int Functions<S,D>
   // we do not want to measure init stuff
   auto start = std::chrono::steady_clock::now();
 
+  // If requested, find the columns that have hydrometeors (or may nucleate ice),
+  // and run the p3 main loop only on those. The other columns only need their
+  // (small) hydrometeor mass returned to vapor, which is a much cheaper kernel.
+  // Active columns are stored at the front of col_order, dry ones at the back.
+  const bool compact = infrastructure.compact_active_columns;
+  const auto& col_order = infrastructure.col_order;
+  Int num_active = nj;
+  if (compact) {
+    const auto& has_work = infrastructure.has_work;
+    EKAT_REQUIRE_MSG (has_work.extent_int(0)>=nj && col_order.extent_int(0)>=nj,
+        "Error! P3Infrastructure::has_work and col_order must be allocated with at least nj entries\n"
+        "       when compact_active_columns is true.\n");
+
+    Kokkos::parallel_for(
+      "p3 active columns",
+      policy,
+      KOKKOS_LAMBDA(const MemberType& team) {
+
+      const Int i = team.league_rank();
+      const bool wet = p3_main_column_has_work(
+        team, nk,
+        ekat::subview(diagnostic_inputs.pres, i),
+        ekat::subview(diagnostic_inputs.inv_exner, i),
+        ekat::subview(prognostic_state.th, i),
+        ekat::subview(prognostic_state.qv, i),
+        ekat::subview(prognostic_state.qc, i),
+        ekat::subview(prognostic_state.qr, i),
+        ekat::subview(prognostic_state.qi, i));
+      Kokkos::single(Kokkos::PerTeam(team), [&] () {
+        has_work(i) = wet;
+      });
+    });
+
+    Kokkos::parallel_scan(
+      "p3 compact columns",
+      Kokkos::RangePolicy<ExeSpace>(0, nj),
+      KOKKOS_LAMBDA(const Int i, Int& num_wet, const bool final) {
+      if (final) {
+        if (has_work(i)) {
+          col_order(num_wet) = i;
+        } else {
+          col_order(nj-1-(i-num_wet)) = i;
+        }
+      }
+      if (has_work(i)) {
+        ++num_wet;
+      }
+    }, num_active);
+
+    const Int num_dry = nj - num_active;
+    const auto dry_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_dry, nk_pack);
+    Kokkos::parallel_for(
+      "p3 main dry columns",
+      dry_policy,
+      KOKKOS_LAMBDA(const MemberType& team) {
+
+      const Int i = col_order(num_active + team.league_rank());
+      p3_main_dry_column(
+        team, nk,
+        ekat::subview(diagnostic_inputs.inv_exner, i),
+        ekat::subview(latent_heat_vapor, i),
+        ekat::subview(latent_heat_sublim, i),
+        ekat::subview(prognostic_state.qv, i),
+        ekat::subview(prognostic_state.th, i),
+        ekat::subview(prognostic_state.qc, i),
+        ekat::subview(prognostic_state.nc, i),
+        ekat::subview(prognostic_state.qr, i),
+        ekat::subview(prognostic_state.nr, i),
+        ekat::subview(prognostic_state.qi, i),
+        ekat::subview(prognostic_state.ni, i),
+        ekat::subview(prognostic_state.qm, i),
+        ekat::subview(prognostic_state.bm, i),
+        ekat::subview(diagnostic_outputs.diag_eff_radius_qc, i),
+        ekat::subview(diagnostic_outputs.diag_eff_radius_qi, i),
+        ekat::subview(diagnostic_outputs.rho_qi, i),
+        ekat::subview(diagnostic_outputs.qv2qi_depos_tend, i),
+        ekat::subview(diagnostic_outputs.precip_liq_flux, i),
+        ekat::subview(diagnostic_outputs.precip_ice_flux, i),
+        diagnostic_outputs.precip_liq_surf(i),
+        diagnostic_outputs.precip_ice_surf(i));
+    });
+  }
+  const auto main_policy = compact ?
+    ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_active, nk_pack) : policy;
+
   // p3_main loop
   Kokkos::parallel_for(
     "p3 main loop",
-    policy,
+    main_policy,
     KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = compact ? col_order(team.league_rank()) : team.league_rank();
 
     auto workspace = workspace_mgr.get_workspace(team);
 
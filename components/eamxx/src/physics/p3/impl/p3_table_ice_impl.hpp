@@ -3,7 +3,12 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
+#include <sstream>
+#include <unistd.h>
 
 namespace scream {
 namespace p3 {
@@ -14,25 +19,63 @@ namespace p3 {
  */
 
 template <typename S, typename D>
-void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
-
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
-
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
-
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
-
-  //
-  // read in ice microphysics table into host views
-  //
+bool Functions<S,D>
+::read_ice_lookup_tables(const std::string& filename, const std::string& cache_dir,
+                         std::vector<double>& ice_table, std::vector<double>& collect_table)
+{
+  constexpr int ice_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  constexpr int collect_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
+  ice_table.resize(ice_size);
+  collect_table.resize(collect_size);
+
+  // Load the whole text table. Even when the cache is used, we need its checksum,
+  // and reading the file is cheap compared to parsing it.
+  std::ifstream in_file(filename);
+  EKAT_REQUIRE_MSG(in_file.good(), "Could not open ice lookup table " << filename);
+  std::stringstream text_ss;
+  text_ss << in_file.rdbuf();
+  const std::string text = text_ss.str();
+
+  // FNV-1a hash of the text table, so that any change to the table invalidates the cache
+  std::uint64_t checksum = 14695981039346656037ULL;
+  for (const char c : text) {
+    checksum = (checksum ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+  }
 
-  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+  // Binary cache header: format version, checksum of the text table, table dims.
+  // The dims also catch a cache written by a build with different table sizes.
+  const int dims[] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                      P3C::rcollsize, P3C::collect_table_size};
+  constexpr int ndims = sizeof(dims)/sizeof(int);
+
+  std::string bin_filename;
+  if (cache_dir != "") {
+    const auto slash = filename.find_last_of('/');
+    const auto basename = slash==std::string::npos ? filename : filename.substr(slash+1);
+    bin_filename = cache_dir + "/" + basename + P3C::p3_lookup_bin_suffix;
+
+    std::ifstream bin(bin_filename, std::ios::binary);
+    if (bin.good()) {
+      int format = -1, bin_dims[ndims] = {0};
+      std::uint64_t bin_checksum = 0;
+      bin.read(reinterpret_cast<char*>(&format), sizeof(int));
+      bin.read(reinterpret_cast<char*>(&bin_checksum), sizeof(bin_checksum));
+      bin.read(reinterpret_cast<char*>(bin_dims), sizeof(bin_dims));
+      const bool valid = bin.good() && format == P3C::p3_lookup_bin_format &&
+                         bin_checksum == checksum &&
+                         std::equal(dims, dims+ndims, bin_dims);
+      if (valid) {
+        bin.read(reinterpret_cast<char*>(ice_table.data()), ice_size*sizeof(double));
+        bin.read(reinterpret_cast<char*>(collect_table.data()), collect_size*sizeof(double));
+        if (bin.good()) {
+          return true;
+        }
+      }
+      // An invalid or truncated cache is not an error: fall back to the text table.
+    }
+  }
 
-  std::ifstream in(filename);
+  std::istringstream in(text);
 
   // read header
   std::string version, version_val;
@@ -40,6 +83,15 @@ void Functions<S,D>
   EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
   EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
 
+  // Same layout as the (LayoutRight) host views of the tables, i.e., quantity first.
+  // The text table has the quantities last, so this is a transpose.
+  const auto ice_idx = [&](const int jj, const int ii, const int i, const int j) {
+    return ((j*P3C::densize + jj)*P3C::rimsize + ii)*P3C::isize + i;
+  };
+  const auto collect_idx = [&](const int jj, const int ii, const int i, const int j, const int k) {
+    return (((k*P3C::densize + jj)*P3C::rimsize + ii)*P3C::isize + i)*P3C::rcollsize + j;
+  };
+
   // read tables
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
   for (int jj = 0; jj < P3C::densize; ++jj) {
@@ -50,7 +102,7 @@ void Functions<S,D>
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            ice_table[ice_idx(jj, ii, i, j_idx++)] = dum_s;
           }
         }
       }
@@ -62,13 +114,77 @@ void Functions<S,D>
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              collect_table[collect_idx(jj, ii, i, j, k_idx++)] = std::log10(dum_s);
             }
           }
         }
       }
     }
   }
+  EKAT_REQUIRE_MSG(!in.fail(), "Bad " << filename << ", could not read the full ice lookup table");
+
+  if (cache_dir == "") {
+    return false;
+  }
+
+  // Write the binary cache for the next call. Failing to do so is not an error.
+  // The temporary file is per process, since several runs may share the cache dir.
+  const std::string tmp_filename = bin_filename + ".tmp" + std::to_string(getpid());
+  std::ofstream bout(tmp_filename, std::ios::binary);
+  if (bout.good()) {
+    const int format = P3C::p3_lookup_bin_format;
+    bout.write(reinterpret_cast<const char*>(&format), sizeof(int));
+    bout.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+    bout.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+    bout.write(reinterpret_cast<const char*>(ice_table.data()), ice_size*sizeof(double));
+    bout.write(reinterpret_cast<const char*>(collect_table.data()), collect_size*sizeof(double));
+    bout.close();
+    // Rename, so that concurrent readers never see a partially written cache
+    if (!bout.fail()) {
+      std::rename(tmp_filename.c_str(), bin_filename.c_str());
+    } else {
+      std::remove(tmp_filename.c_str());
+    }
+  }
+  return false;
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  // Without a comm, every rank reads the table
+  init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals, ekat::Comm(MPI_COMM_SELF));
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm, const std::string& cache_dir) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  //
+  // read in ice microphysics table on the root rank, and broadcast it
+  //
+
+  std::vector<double> ice_table(ice_table_vals_h.size()), collect_table(collect_table_vals_h.size());
+  if (comm.am_i_root()) {
+    const std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+    read_ice_lookup_tables(filename, cache_dir, ice_table, collect_table);
+  }
+  comm.broadcast(ice_table.data(), ice_table.size(), comm.root_rank());
+  comm.broadcast(collect_table.data(), collect_table.size(), comm.root_rank());
+
+  // The host views are LayoutRight, like the flat arrays
+  std::copy(ice_table.begin(), ice_table.end(), ice_table_vals_h.data());
+  std::copy(collect_table.begin(), collect_table.end(), collect_table_vals_h.data());
 
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
@@ -178,42 +294,68 @@ typename Functions<S,D>::Spack Functions<S,D>
 ::apply_table_ice(const int& idx, const view_ice_table& ice_table_vals, const TableIce& tab,
                   const Smask& context)
 {
-  using ekat::index;
-
   Spack proc;
-  IntSmallPack idxpk(idx);
+  apply_table_ice(&idx, 1, ice_table_vals, tab, &proc, context);
+  return proc;
+}
 
-  if (!context.any()) return proc;
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_ice(const int* idx, const int nidx, const view_ice_table& ice_table_vals,
+                  const TableIce& tab, Spack* proc, const Smask& context)
+{
+  if (!context.any()) return;
 
-  // get value at current density index
+  // Strides in the (LayoutRight) table
+  constexpr int sq  = P3C::densize*P3C::rimsize*P3C::isize;
+  constexpr int sjj = P3C::rimsize*P3C::isize;
+  constexpr int sii = P3C::isize;
 
-  // first interpolate for current rimed fraction index
-  auto iproc1 = index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi, idxpk));
+  // The table is read only, with a data-dependent access pattern: on GPU,
+  // RandomAccess loads go through the read-only data cache.
+  using RandomAccessTable = Kokkos::View<const Scalar*, typename view_ice_table::array_layout,
+                                         typename view_ice_table::device_type,
+                                         Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  const RandomAccessTable table(ice_table_vals.data(), ice_table_vals.size());
 
-  // linearly interpolate to get process rates for rimed fraction index + 1
-  auto gproc1 = index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi, idxpk));
+  for (int s = 0; s < Spack::n; ++s) {
+    // Interpolation weights and stencil are the same for all quantities
+    const Scalar w1 = tab.dum1[s] - Scalar(tab.dumi[s]) - 1;
+    const Scalar w4 = tab.dum4[s] - Scalar(tab.dumii[s]) - 1;
+    const Scalar w5 = tab.dum5[s] - Scalar(tab.dumjj[s]) - 1;
+    const int k00 = tab.dumjj[s]*sjj + tab.dumii[s]*sii + tab.dumi[s];
+    const int k01 = k00 + sii;
+    const int k10 = k00 + sjj;
+    const int k11 = k10 + sii;
 
-  const auto tmp1   = iproc1 + (tab.dum4-Spack(tab.dumii)-1) * (gproc1-iproc1);
+    for (int q = 0; q < nidx; ++q) {
+      const int kq = idx[q]*sq;
 
-  // get value at density index + 1
+      // get value at current density index
 
-  // first interpolate for current rimed fraction index
+      // first interpolate for current rimed fraction index
+      auto iproc1 = table(kq+k00) + w1 * (table(kq+k00+1) - table(kq+k00));
 
-  iproc1 = index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi, idxpk));
+      // linearly interpolate to get process rates for rimed fraction index + 1
+      auto gproc1 = table(kq+k01) + w1 * (table(kq+k01+1) - table(kq+k01));
 
-  // linearly interpolate to get process rates for rimed fraction index + 1
+      const auto tmp1 = iproc1 + w4 * (gproc1-iproc1);
 
-  gproc1 = index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi+1, idxpk)-index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi, idxpk));
+      // get value at density index + 1
 
-  const auto tmp2 = iproc1+(tab.dum4 - Spack(tab.dumii) - 1) * (gproc1-iproc1);
+      // first interpolate for current rimed fraction index
+      iproc1 = table(kq+k10) + w1 * (table(kq+k10+1) - table(kq+k10));
 
-  // get final process rate
-  proc = tmp1 + (tab.dum5 - Spack(tab.dumjj) - 1) * (tmp2-tmp1);
-  return proc;
+      // linearly interpolate to get process rates for rimed fraction index + 1
+      gproc1 = table(kq+k11) + w1 * (table(kq+k11+1) - table(kq+k11));
+
+      const auto tmp2 = iproc1 + w4 * (gproc1-iproc1);
+
+      // get final process rate
+      proc[q][s] = tmp1 + w5 * (tmp2-tmp1);
+    }
+  }
 }
 
 template <typename S, typename D>
@@ -223,77 +365,66 @@ typename Functions<S,D>::Spack Functions<S,D>
                    const TableIce& ti, const TableRain& tr,
                    const Smask& context)
 {
-  using ekat::index;
-
   Spack proc;
-  IntSmallPack idxpk(idx);
-
-  if (!context.any()) return proc;
-
-  // current density index
-
-  // current rime fraction index
-  auto dproc1  = index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj, idxpk));
-
-  auto dproc2  = index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj+1, idxpk));
-
-  auto iproc1  = dproc1+(tr.dum3 - Spack(tr.dumj) - 1) * (dproc2 - dproc1);
-
-  // rime fraction index + 1
-
-  dproc1  = index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk));
-
-  auto gproc1  = dproc1+(tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-  const auto tmp1    = iproc1+(ti.dum4 - Spack(ti.dumii) - 1) * (gproc1-iproc1);
-
-  // density index + 1
-
-  // current rime fraction index
-
-  dproc1  = index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj+1, idxpk));
-
-  iproc1  = dproc1 + (tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-
-  // rime fraction index + 1
-
-  dproc1  = index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk));
+  apply_table_coll(&idx, 1, collect_table_vals, ti, tr, &proc, context);
+  return proc;
+}
 
-  gproc1  = dproc1 + (tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-  const auto tmp2    = iproc1 + (ti.dum4 - Spack(ti.dumii) - 1) * (gproc1-iproc1);
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_coll(const int* idx, const int nidx, const view_collect_table& collect_table_vals,
+                   const TableIce& ti, const TableRain& tr, Spack* proc,
+                   const Smask& context)
+{
+  if (!context.any()) return;
 
-  // interpolate over density to get final values
-  proc    = tmp1+(ti.dum5 - Spack(ti.dumjj) - 1) * (tmp2-tmp1);
-  return proc;
+  // Strides in the (LayoutRight) table
+  constexpr int sq  = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize;
+  constexpr int sjj = P3C::rimsize*P3C::isize*P3C::rcollsize;
+  constexpr int sii = P3C::isize*P3C::rcollsize;
+  constexpr int si  = P3C::rcollsize;
+
+  using RandomAccessTable = Kokkos::View<const Scalar*, typename view_collect_table::array_layout,
+                                         typename view_collect_table::device_type,
+                                         Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  const RandomAccessTable table(collect_table_vals.data(), collect_table_vals.size());
+
+  for (int s = 0; s < Spack::n; ++s) {
+    const Scalar w1 = ti.dum1[s] - Scalar(ti.dumi[s]) - 1;
+    const Scalar w3 = tr.dum3[s] - Scalar(tr.dumj[s]) - 1;
+    const Scalar w4 = ti.dum4[s] - Scalar(ti.dumii[s]) - 1;
+    const Scalar w5 = ti.dum5[s] - Scalar(ti.dumjj[s]) - 1;
+    const int k00 = ti.dumjj[s]*sjj + ti.dumii[s]*sii + ti.dumi[s]*si + tr.dumj[s];
+    const int k01 = k00 + sii;
+    const int k10 = k00 + sjj;
+    const int k11 = k10 + sii;
+
+    for (int q = 0; q < nidx; ++q) {
+      const int kq = idx[q]*sq;
+
+      // Bilinear interpolation in (i,j) at fixed density/rime fraction indices.
+      // The j, j+1 entries are contiguous.
+      const auto interp_ij = [&] (const int k) {
+        const auto dproc1 = table(kq+k)   + w1 * (table(kq+k+si)   - table(kq+k));
+        const auto dproc2 = table(kq+k+1) + w1 * (table(kq+k+si+1) - table(kq+k+1));
+        return dproc1 + w3 * (dproc2 - dproc1);
+      };
+
+      // current density index
+      auto iproc1 = interp_ij(k00);           // current rime fraction index
+      auto gproc1 = interp_ij(k01);           // rime fraction index + 1
+      const auto tmp1 = iproc1 + w4 * (gproc1-iproc1);
+
+      // density index + 1
+      iproc1 = interp_ij(k10);
+      gproc1 = interp_ij(k11);
+      const auto tmp2 = iproc1 + w4 * (gproc1-iproc1);
+
+      // interpolate over density to get final values
+      proc[q][s] = tmp1 + w5 * (tmp2-tmp1);
+    }
+  }
 }
 
 } // namespace p3
@@ -7,6 +7,10 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -48,6 +52,11 @@ struct Functions
     static constexpr const char* p3_lookup_base = SCREAM_DATA_DIR "/tables/p3_lookup_table_1.dat-v";
 
     static constexpr const char* p3_version = "4.1.1"; // TODO: Change this so that the table version and table path is a runtime option.
+
+    // Binary cache of the ice lookup table (see read_ice_lookup_tables).
+    // Bump the format version if its layout changes.
+    static constexpr const char* p3_lookup_bin_suffix = ".bin";
+    static constexpr int p3_lookup_bin_format = 3;
   };
 
   //
@@ -84,11 +93,13 @@ struct Functions
   // lookup table values for rain number- and mass-weighted fallspeeds and ventilation parameters
   using view_2d_table = typename KT::template view_2d_table<Scalar, C::VTABLE_DIM0, C::VTABLE_DIM1>;
 
-  // ice lookup table values
-  using view_ice_table    = typename KT::template view<const Scalar[P3C::densize][P3C::rimsize][P3C::isize][P3C::ice_table_size]>;
+  // ice lookup table values. The tables are stored one quantity after the other,
+  // so that the entries of the interpolation stencil of a quantity are close in memory,
+  // with the isize (resp. rcollsize) neighbors contiguous.
+  using view_ice_table    = typename KT::template view<const Scalar[P3C::ice_table_size][P3C::densize][P3C::rimsize][P3C::isize]>;
 
   // ice lookup table values for ice-rain collision/collection
-  using view_collect_table = typename KT::template view<const Scalar[P3C::densize][P3C::rimsize][P3C::isize][P3C::rcollsize][P3C::collect_table_size]>;
+  using view_collect_table = typename KT::template view<const Scalar[P3C::collect_table_size][P3C::densize][P3C::rimsize][P3C::isize][P3C::rcollsize]>;
 
   // droplet spectral shape parameter for mass spectra, used for Seifert and Beheng (2001)
   // warm rain autoconversion/accretion option only (iparam = 1)
@@ -205,6 +216,12 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // Set to true to run the full p3 kernel only on columns with some work to do
+    bool compact_active_columns = false;
+    // Scratch views for compact_active_columns, of size nj. Allocated by the caller
+    // once, so that p3_main does not allocate them at every call.
+    view_1d<bool> has_work;
+    view_1d<Int>  col_order;
   };
 
   // This struct stores tendencies computed by P3 and used by other
@@ -262,6 +279,24 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only the root rank of comm reads the table from file,
+  // and broadcasts it to the other ranks. If cache_dir is not empty, it is
+  // used to cache the parsed table (see read_ice_lookup_tables).
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm, const std::string& cache_dir = "");
+
+  // Read the ice lookup tables from the text file 'filename' into flat host arrays,
+  // in the layout of view_ice_table and view_collect_table (collection quantities
+  // already in log10). If cache_dir is not empty, the parsed tables are stored in
+  // a binary file in cache_dir, which later calls read instead of parsing the text,
+  // as long as the content of the text file does not change.
+  // Returns true if the tables were read from the binary cache.
+  static bool read_ice_lookup_tables(const std::string& filename,
+                                     const std::string& cache_dir,
+                                     std::vector<double>& ice_table,
+                                     std::vector<double>& collect_table);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -312,12 +347,25 @@ struct Functions
                                const TableIce& tab,
                                const Smask& context = Smask(true) );
 
+  // Same as above, for nindex quantities at once, stored in proc[0:nindex].
+  // The stencil and weights are computed once per pack entry for all quantities.
+  KOKKOS_FUNCTION
+  static void apply_table_ice(const int* index, const int nindex, const view_ice_table& ice_table_vals,
+                              const TableIce& tab, Spack* proc,
+                              const Smask& context = Smask(true) );
+
   // Interpolates lookup table values for rain/ice collection processes
   KOKKOS_FUNCTION
   static Spack apply_table_coll(const int& index, const view_collect_table& collect_table_vals,
                                 const TableIce& ti, const TableRain& tr,
                                 const Smask& context = Smask(true) );
 
+  // Same as above, for nindex quantities at once, stored in proc[0:nindex].
+  KOKKOS_FUNCTION
+  static void apply_table_coll(const int* index, const int nindex, const view_collect_table& collect_table_vals,
+                               const TableIce& ti, const TableRain& tr, Spack* proc,
+                               const Smask& context = Smask(true) );
+
   // -- Sedimentation time step
 
   // Calculate the first-order upwind step in the region [k_bot,
@@ -780,6 +828,49 @@ struct Functions
     Scalar& precip_ice_surf,
     view_1d_ptr_array<Spack, 36>& zero_init);
 
+  // Returns true if p3_main_part1 would find hydrometeors in the column, or
+  // conditions for ice nucleation. Does not modify any of its inputs.
+  KOKKOS_FUNCTION
+  static bool p3_main_column_has_work(
+    const MemberType& team,
+    const Int& nk,
+    const uview_1d<const Spack>& pres,
+    const uview_1d<const Spack>& inv_exner,
+    const uview_1d<const Spack>& th_atm,
+    const uview_1d<const Spack>& qv,
+    const uview_1d<const Spack>& qc,
+    const uview_1d<const Spack>& qr,
+    const uview_1d<const Spack>& qi);
+
+  // Equivalent of p3_main_init+p3_main_part1 for a column where
+  // p3_main_column_has_work returns false: all hydrometeor mass is
+  // returned to vapor, and the diagnostic outputs are initialized.
+  KOKKOS_FUNCTION
+  static void p3_main_dry_column(
+    const MemberType& team,
+    const Int& nk,
+    const uview_1d<const Spack>& inv_exner,
+    const uview_1d<const Spack>& latent_heat_vapor,
+    const uview_1d<const Spack>& latent_heat_sublim,
+    const uview_1d<Spack>& qv,
+    const uview_1d<Spack>& th_atm,
+    const uview_1d<Spack>& qc,
+    const uview_1d<Spack>& nc,
+    const uview_1d<Spack>& qr,
+    const uview_1d<Spack>& nr,
+    const uview_1d<Spack>& qi,
+    const uview_1d<Spack>& ni,
+    const uview_1d<Spack>& qm,
+    const uview_1d<Spack>& bm,
+    const uview_1d<Spack>& diag_eff_radius_qc,
+    const uview_1d<Spack>& diag_eff_radius_qi,
+    const uview_1d<Spack>& rho_qi,
+    const uview_1d<Spack>& qv2qi_depos_tend,
+    const uview_1d<Spack>& precip_liq_flux,
+    const uview_1d<Spack>& precip_ice_flux,
+    Scalar& precip_liq_surf,
+    Scalar& precip_ice_surf);
+
   KOKKOS_FUNCTION
   static void p3_main_part1(
     const MemberType& team,
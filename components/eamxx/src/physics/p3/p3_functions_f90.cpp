@@ -1924,7 +1924,8 @@ Int p3_main_f(
   Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
   Real* diag_eff_radius_qi, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
   Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i,
-  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev,
+  bool compact_active_columns)
 {
   using P3F  = Functions<Real, DefaultDevice>;
 
@@ -2044,7 +2045,12 @@ Int p3_main_f(
                                         precip_ice_surf_d, diag_eff_radius_qc_d, diag_eff_radius_qi_d,
                                         rho_qi_d,precip_liq_flux_d, precip_ice_flux_d};
   P3F::P3Infrastructure infrastructure{dt, it, its, ite, kts, kte,
-                                       do_predict_nc, do_prescribed_CCN, col_location_d};
+                                       do_predict_nc, do_prescribed_CCN, col_location_d,
+                                       compact_active_columns};
+  if (compact_active_columns) {
+    infrastructure.has_work  = P3F::view_1d<bool>("has_work", nj);
+    infrastructure.col_order = P3F::view_1d<Int>("col_order", nj);
+  }
   P3F::P3HistoryOnly history_only{liq_ice_exchange_d, vap_liq_exchange_d,
                                   vap_ice_exchange_d};
 
@@ -11,7 +11,11 @@
 #include <thread>
 #include <array>
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <random>
+#include <sys/stat.h>
 
 namespace scream {
 namespace p3 {
@@ -26,41 +30,99 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
 
   static void test_read_lookup_tables_bfb()
   {
-    // Read in ice tables
-    view_ice_table ice_table_vals;
-    view_collect_table collect_table_vals;
-    Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
-
     // Get data from fortran
     P3InitAFortranData d;
     p3_init_a(d);
 
-    // Copy device data to host
-    const auto ice_table_vals_host = Kokkos::create_mirror_view(ice_table_vals);
-    const auto collect_table_vals_host = Kokkos::create_mirror_view(collect_table_vals);
-    Kokkos::deep_copy(ice_table_vals_host, ice_table_vals);
-    Kokkos::deep_copy(collect_table_vals_host, collect_table_vals);
+    // Read in ice tables. The second read goes through the comm overload.
+    for (const bool use_comm : {false, true}) {
+      view_ice_table ice_table_vals;
+      view_collect_table collect_table_vals;
+      if (use_comm) {
+        Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals, ekat::Comm(MPI_COMM_WORLD));
+      } else {
+        Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+      }
 
-    // Compare (on host)
-    for (size_t i = 0; i < ice_table_vals_host.extent(0); ++i) {
-      for (size_t j = 0; j < ice_table_vals_host.extent(1); ++j) {
-        for (size_t k = 0; k < ice_table_vals_host.extent(2); ++k) {
+      // Copy device data to host
+      const auto ice_table_vals_host = Kokkos::create_mirror_view(ice_table_vals);
+      const auto collect_table_vals_host = Kokkos::create_mirror_view(collect_table_vals);
+      Kokkos::deep_copy(ice_table_vals_host, ice_table_vals);
+      Kokkos::deep_copy(collect_table_vals_host, collect_table_vals);
 
-          for (size_t l = 0; l < ice_table_vals_host.extent(3); ++l) {
-            REQUIRE(ice_table_vals_host(i, j, k, l) == d.ice_table_vals(i, j, k, l));
-          }
+      // Compare (on host). The C++ tables store the quantity index first.
+      for (size_t i = 0; i < d.ice_table_vals.extent(0); ++i) {
+        for (size_t j = 0; j < d.ice_table_vals.extent(1); ++j) {
+          for (size_t k = 0; k < d.ice_table_vals.extent(2); ++k) {
 
-          for (size_t l = 0; l < collect_table_vals_host.extent(3); ++l) {
-            for (size_t m = 0; m < collect_table_vals_host.extent(4); ++m) {
-              REQUIRE(collect_table_vals_host(i, j, k, l, m) == d.collect_table_vals(i, j, k, l, m));
+            for (size_t l = 0; l < d.ice_table_vals.extent(3); ++l) {
+              REQUIRE(ice_table_vals_host(l, i, j, k) == d.ice_table_vals(i, j, k, l));
             }
-          }
 
+            for (size_t l = 0; l < d.collect_table_vals.extent(3); ++l) {
+              for (size_t m = 0; m < d.collect_table_vals.extent(4); ++m) {
+                REQUIRE(collect_table_vals_host(m, i, j, k, l) == d.collect_table_vals(i, j, k, l, m));
+              }
+            }
+
+          }
         }
       }
     }
   }
 
+  static void test_read_lookup_tables_cache()
+  {
+    const std::string filename = std::string(Functions::P3C::p3_lookup_base) + std::string(Functions::P3C::p3_version);
+    const auto slash = filename.find_last_of('/');
+    const std::string basename = filename.substr(slash+1);
+
+    // Use a fresh cache dir, with a copy of the text table in a subfolder
+    char dir_template[] = "p3_ice_table_cache_XXXXXX";
+    REQUIRE (mkdtemp(dir_template)!=nullptr);
+    const std::string cache_dir = dir_template;
+    const std::string text_dir = cache_dir + "/text";
+    REQUIRE (mkdir(text_dir.c_str(),0755)==0);
+    const std::string bin_filename  = cache_dir + "/" + basename + Functions::P3C::p3_lookup_bin_suffix;
+    const std::string text_filename = text_dir + "/" + basename;
+
+    // Text path, without cache
+    std::vector<double> ice_ref, collect_ref;
+    REQUIRE (not Functions::read_ice_lookup_tables(filename, "", ice_ref, collect_ref));
+    REQUIRE (not std::ifstream(bin_filename).good());
+
+    // Text path, which writes the cache
+    std::vector<double> ice, collect;
+    REQUIRE (not Functions::read_ice_lookup_tables(filename, cache_dir, ice, collect));
+    REQUIRE (std::ifstream(bin_filename).good());
+    REQUIRE (ice==ice_ref);
+    REQUIRE (collect==collect_ref);
+
+    // Binary path
+    ice.clear();
+    collect.clear();
+    REQUIRE (Functions::read_ice_lookup_tables(filename, cache_dir, ice, collect));
+    REQUIRE (ice==ice_ref);
+    REQUIRE (collect==collect_ref);
+
+    // A text table with the same version and a different content invalidates the cache
+    {
+      std::ifstream src(filename);
+      std::ofstream dst(text_filename);
+      dst << src.rdbuf() << "\n";
+    }
+    REQUIRE (not Functions::read_ice_lookup_tables(text_filename, cache_dir, ice, collect));
+    REQUIRE (ice==ice_ref);
+    REQUIRE (collect==collect_ref);
+    REQUIRE (Functions::read_ice_lookup_tables(text_filename, cache_dir, ice, collect));
+
+    // Clean up
+    std::remove(text_filename.c_str());
+    std::remove(bin_filename.c_str());
+    std::remove(text_dir.c_str());
+    std::remove(cache_dir.c_str());
+  }
+
   template <typename View>
   static void init_table_linear_dimension(View& table, int linear_dimension)
   {
@@ -346,6 +408,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_read_lookup_tables_cache();
   TTI::run_phys();
   TTI::run_bfb();
 }
@@ -38,7 +38,94 @@ static void run_phys_p3_main_part3()
 
 static void run_phys_p3_main()
 {
-  // TODO
+  // Running p3_main only on the active columns must give the same
+  // results as running it on all columns.
+  auto engine = setup_random_test();
+
+  P3MainData d_all(1, 10, 1, 72, 1, 1.800E+03, true, false);
+  d_all.randomize(engine, {
+      {d_all.pres           , {1.00000000E+02 , 9.87111111E+04}},
+      {d_all.dz             , {1.22776609E+02 , 3.49039167E+04}},
+      {d_all.nc_nuceat_tend , {0              , 0}},
+      {d_all.nccn_prescribed, {0              , 0}},
+      {d_all.ni_activated   , {0              , 0}},
+      {d_all.dpres          , {1.37888889E+03, 1.39888889E+03}},
+      {d_all.inv_exner      , {1.00371345E+00, 3.19721007E+00}},
+      {d_all.cld_frac_i     , {1              , 1}},
+      {d_all.cld_frac_l     , {1              , 1}},
+      {d_all.cld_frac_r     , {1              , 1}},
+      {d_all.inv_qc_relvar  , {1              , 1}},
+      {d_all.qc             , {0              , 1.00000000E-04}},
+      {d_all.nc             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_all.qr             , {0              , 1.00000000E-05}},
+      {d_all.nr             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_all.qi             , {0              , 1.00000000E-04}},
+      {d_all.qm             , {0              , 1.00000000E-04}},
+      {d_all.ni             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_all.bm             , {0              , 1.00000000E-02}},
+      {d_all.qv             , {0              , 5.00000000E-02}},
+      {d_all.qv_prev        , {0              , 5.00000000E-02}},
+      {d_all.th_atm         , {6.72653866E+02 , 1.07954335E+03}},
+      {d_all.t_prev         , {1.50000000E+02 , 3.50000000E+02}},
+  });
+
+  // Make every other column dry (no condensate, no vapor, hence no nucleation),
+  // and leave some tiny condensate in the others, so that both kernels are exercised.
+  const Int ncol = d_all.ite - d_all.its + 1;
+  const Int nk   = d_all.kte - d_all.kts + 1;
+  for (Int i = 0; i < ncol; i += 2) {
+    for (Int k = 0; k < nk; ++k) {
+      const Int idx = i*nk + k;
+      d_all.qc[idx] = d_all.qr[idx] = d_all.qi[idx] = 0;
+      d_all.qv[idx] = 0;
+      if (k % 3 == 0) {
+        d_all.qc[idx] = 1e-16;
+        d_all.qr[idx] = 1e-16;
+      }
+    }
+  }
+
+  P3MainData d_active(d_all);
+
+  for (auto* d : {&d_all, &d_active}) {
+    d->template transpose<ekat::TransposeDirection::c2f>();
+    p3_main_f(
+      d->qc, d->nc, d->qr, d->nr, d->th_atm, d->qv, d->dt, d->qi, d->qm, d->ni,
+      d->bm, d->pres, d->dz, d->nc_nuceat_tend, d->nccn_prescribed, d->ni_activated, d->inv_qc_relvar, d->it, d->precip_liq_surf,
+      d->precip_ice_surf, d->its, d->ite, d->kts, d->kte, d->diag_eff_radius_qc, d->diag_eff_radius_qi,
+      d->rho_qi, d->do_predict_nc, d->do_prescribed_CCN, d->dpres, d->inv_exner, d->qv2qi_depos_tend,
+      d->precip_liq_flux, d->precip_ice_flux, d->cld_frac_r, d->cld_frac_l, d->cld_frac_i,
+      d->liq_ice_exchange, d->vap_liq_exchange, d->vap_ice_exchange, d->qv_prev, d->t_prev,
+      d==&d_active);
+    d->template transpose<ekat::TransposeDirection::f2c>();
+  }
+
+  const auto tot = d_all.total(d_all.qc);
+  for (Int t = 0; t < tot; ++t) {
+    REQUIRE(d_all.qc[t]                 == d_active.qc[t]);
+    REQUIRE(d_all.nc[t]                 == d_active.nc[t]);
+    REQUIRE(d_all.qr[t]                 == d_active.qr[t]);
+    REQUIRE(d_all.nr[t]                 == d_active.nr[t]);
+    REQUIRE(d_all.qi[t]                 == d_active.qi[t]);
+    REQUIRE(d_all.qm[t]                 == d_active.qm[t]);
+    REQUIRE(d_all.ni[t]                 == d_active.ni[t]);
+    REQUIRE(d_all.bm[t]                 == d_active.bm[t]);
+    REQUIRE(d_all.qv[t]                 == d_active.qv[t]);
+    REQUIRE(d_all.th_atm[t]             == d_active.th_atm[t]);
+    REQUIRE(d_all.diag_eff_radius_qc[t] == d_active.diag_eff_radius_qc[t]);
+    REQUIRE(d_all.diag_eff_radius_qi[t] == d_active.diag_eff_radius_qi[t]);
+    REQUIRE(d_all.rho_qi[t]             == d_active.rho_qi[t]);
+    REQUIRE(d_all.qv2qi_depos_tend[t]   == d_active.qv2qi_depos_tend[t]);
+    REQUIRE(d_all.liq_ice_exchange[t]   == d_active.liq_ice_exchange[t]);
+    REQUIRE(d_all.vap_liq_exchange[t]   == d_active.vap_liq_exchange[t]);
+    REQUIRE(d_all.vap_ice_exchange[t]   == d_active.vap_ice_exchange[t]);
+    REQUIRE(d_all.precip_liq_flux[t]    == d_active.precip_liq_flux[t]);
+    REQUIRE(d_all.precip_ice_flux[t]    == d_active.precip_ice_flux[t]);
+  }
+  for (Int i = 0; i < ncol; ++i) {
+    REQUIRE(d_all.precip_liq_surf[i]    == d_active.precip_liq_surf[i]);
+    REQUIRE(d_all.precip_ice_surf[i]    == d_active.precip_ice_surf[i]);
+  }
 }
 
 static void run_phys()
@@ -171,6 +171,7 @@ size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
     Buffer::num_2d_nlay*m_col_chunk_size*m_nlay +
     Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1) +
     Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands +
+    Buffer::num_2d_nswgpts*m_col_chunk_size*m_nswgpts +
     Buffer::num_3d_nlev_nswbands*m_col_chunk_size*(m_nlay+1)*m_nswbands +
     Buffer::num_3d_nlev_nlwbands*m_col_chunk_size*(m_nlay+1)*m_nlwbands +
     Buffer::num_3d_nlay_nswbands*m_col_chunk_size*(m_nlay)*m_nswbands +
@@ -296,6 +297,64 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   m_buffer.cld_tau_lw_gpt = decltype(m_buffer.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunk_size, m_nlay, m_nlwgpts);
   mem += m_buffer.cld_tau_lw_gpt.totElems();
 
+  // SW daytime workspace
+  auto& sw_day = m_buffer.sw_daytime;
+  static_assert(sizeof(int)<=sizeof(Real), "Error! Cannot store day indices in Real buffer memory.\n");
+  sw_day.day_indices = decltype(sw_day.day_indices)("dayIndices", reinterpret_cast<int*>(mem), m_col_chunk_size);
+  mem += m_col_chunk_size;
+  sw_day.mu0_day = decltype(sw_day.mu0_day)("mu0_day", mem, m_col_chunk_size);
+  mem += sw_day.mu0_day.totElems();
+  sw_day.p_lay_day = decltype(sw_day.p_lay_day)("p_lay_day", mem, m_col_chunk_size, m_nlay);
+  mem += sw_day.p_lay_day.totElems();
+  sw_day.t_lay_day = decltype(sw_day.t_lay_day)("t_lay_day", mem, m_col_chunk_size, m_nlay);
+  mem += sw_day.t_lay_day.totElems();
+  sw_day.t_lay_limited = decltype(sw_day.t_lay_limited)("t_lay_limited", mem, m_col_chunk_size, m_nlay);
+  mem += sw_day.t_lay_limited.totElems();
+  sw_day.vmr = decltype(sw_day.vmr)("vmr", mem, m_col_chunk_size, m_nlay);
+  mem += sw_day.vmr.totElems();
+  sw_day.vmr_day = decltype(sw_day.vmr_day)("vmr_day", mem, m_col_chunk_size, m_nlay);
+  mem += sw_day.vmr_day.totElems();
+  sw_day.p_lev_day = decltype(sw_day.p_lev_day)("p_lev_day", mem, m_col_chunk_size, m_nlay+1);
+  mem += sw_day.p_lev_day.totElems();
+  sw_day.t_lev_day = decltype(sw_day.t_lev_day)("t_lev_day", mem, m_col_chunk_size, m_nlay+1);
+  mem += sw_day.t_lev_day.totElems();
+  sw_day.flux_up_day = decltype(sw_day.flux_up_day)("flux_up_day", mem, m_col_chunk_size, m_nlay+1);
+  mem += sw_day.flux_up_day.totElems();
+  sw_day.flux_dn_day = decltype(sw_day.flux_dn_day)("flux_dn_day", mem, m_col_chunk_size, m_nlay+1);
+  mem += sw_day.flux_dn_day.totElems();
+  sw_day.flux_dn_dir_day = decltype(sw_day.flux_dn_dir_day)("flux_dn_dir_day", mem, m_col_chunk_size, m_nlay+1);
+  mem += sw_day.flux_dn_dir_day.totElems();
+  sw_day.sfc_alb_dir_T = decltype(sw_day.sfc_alb_dir_T)("sfc_alb_dir_T", mem, m_nswbands, m_col_chunk_size);
+  mem += sw_day.sfc_alb_dir_T.totElems();
+  sw_day.sfc_alb_dif_T = decltype(sw_day.sfc_alb_dif_T)("sfc_alb_dif_T", mem, m_nswbands, m_col_chunk_size);
+  mem += sw_day.sfc_alb_dif_T.totElems();
+  sw_day.toa_flux = decltype(sw_day.toa_flux)("toa_flux", mem, m_col_chunk_size, m_nswgpts);
+  mem += sw_day.toa_flux.totElems();
+  sw_day.bnd_flux_up_day = decltype(sw_day.bnd_flux_up_day)("bnd_flux_up_day", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += sw_day.bnd_flux_up_day.totElems();
+  sw_day.bnd_flux_dn_day = decltype(sw_day.bnd_flux_dn_day)("bnd_flux_dn_day", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += sw_day.bnd_flux_dn_day.totElems();
+  sw_day.bnd_flux_dn_dir_day = decltype(sw_day.bnd_flux_dn_dir_day)("bnd_flux_dn_dir_day", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += sw_day.bnd_flux_dn_dir_day.totElems();
+  sw_day.aer_tau_day = decltype(sw_day.aer_tau_day)("aer_tau_day", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += sw_day.aer_tau_day.totElems();
+  sw_day.aer_ssa_day = decltype(sw_day.aer_ssa_day)("aer_ssa_day", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += sw_day.aer_ssa_day.totElems();
+  sw_day.aer_g_day = decltype(sw_day.aer_g_day)("aer_g_day", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += sw_day.aer_g_day.totElems();
+  sw_day.cld_tau_day = decltype(sw_day.cld_tau_day)("cld_tau_day", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.cld_tau_day.totElems();
+  sw_day.cld_ssa_day = decltype(sw_day.cld_ssa_day)("cld_ssa_day", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.cld_ssa_day.totElems();
+  sw_day.cld_g_day = decltype(sw_day.cld_g_day)("cld_g_day", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.cld_g_day.totElems();
+  sw_day.optics_tau = decltype(sw_day.optics_tau)("optics_tau", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.optics_tau.totElems();
+  sw_day.optics_ssa = decltype(sw_day.optics_ssa)("optics_ssa", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.optics_ssa.totElems();
+  sw_day.optics_g = decltype(sw_day.optics_g)("optics_g", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += sw_day.optics_g.totElems();
+
   size_t used_mem = (reinterpret_cast<Real*>(mem) - buffer_manager.get_memory())*sizeof(Real);
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
@@ -782,7 +841,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         sw_flux_up       , sw_flux_dn       , sw_flux_dn_dir       , lw_flux_up       , lw_flux_dn,
         sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dn_dir, lw_clrsky_flux_up, lw_clrsky_flux_dn,
         sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
-        eccf, m_atm_logger
+        eccf, m_atm_logger, &m_buffer.sw_daytime
       );
 
       // Update heating tendency
@@ -102,15 +102,16 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-    static constexpr int num_1d_ncol        = 10;
-    static constexpr int num_2d_nlay        = 13;
-    static constexpr int num_2d_nlay_p1     = 12;
-    static constexpr int num_2d_nswbands    = 2;
-    static constexpr int num_3d_nlev_nswbands = 4;
+    static constexpr int num_1d_ncol        = 12;
+    static constexpr int num_2d_nlay        = 18;
+    static constexpr int num_2d_nlay_p1     = 17;
+    static constexpr int num_2d_nswbands    = 4;
+    static constexpr int num_2d_nswgpts     = 1;
+    static constexpr int num_3d_nlev_nswbands = 7;
     static constexpr int num_3d_nlev_nlwbands = 2;
-    static constexpr int num_3d_nlay_nswbands = 3;
+    static constexpr int num_3d_nlay_nswbands = 6;
     static constexpr int num_3d_nlay_nlwbands = 1;
-    static constexpr int num_3d_nlay_nswgpts = 1;
+    static constexpr int num_3d_nlay_nswgpts = 7;
     static constexpr int num_3d_nlay_nlwgpts = 1;
 
     // 1d size (ncol)
@@ -177,6 +178,11 @@ public:
     // 3d size (ncol, nlay, n[sw,lw]gpts)
     real3d cld_tau_sw_gpt;
     real3d cld_tau_lw_gpt;
+
+    // Scratch storage for the daytime columns subsetting in the SW driver.
+    // Its arrays are included in the counts above (day_indices is an int
+    // array, but it takes the same room as a 1d real array).
+    rrtmgp::SWDaytimeWorkspace sw_daytime;
   };
 
 protected:
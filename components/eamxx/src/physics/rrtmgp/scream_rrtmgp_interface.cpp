@@ -8,6 +8,10 @@
 #include "cpp/rte/mo_rte_sw.h"
 #include "cpp/rte/mo_rte_lw.h"
 
+#include "ekat/ekat_assert.hpp"
+
+#include <Kokkos_Core.hpp>
+
 namespace scream {
     void yakl_init ()
     {
@@ -224,7 +228,8 @@ namespace scream {
                 real3d &sw_bnd_flux_up, real3d &sw_bnd_flux_dn, real3d &sw_bnd_flux_dn_dir,
                 real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger) {
+                const std::shared_ptr<spdlog::logger>& logger,
+                SWDaytimeWorkspace* sw_workspace) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
             // Sanity check inputs, and possibly repair
@@ -336,7 +341,7 @@ namespace scream {
                 k_dist_sw, p_lay, t_lay, p_lev, t_lev, gas_concs, 
                 sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
                 fluxes_sw, clrsky_fluxes_sw,
-                tsi_scaling, logger
+                tsi_scaling, logger, sw_workspace
             );
 
             // Do longwave
@@ -566,6 +571,49 @@ namespace scream {
         }
 
 
+        void alloc_sw_daytime_workspace(SWDaytimeWorkspace &workspace,
+                const int ncol, const int nlay, const int nbnd, const int ngpt) {
+            workspace.day_indices         = int1d ("dayIndices",          ncol);
+            workspace.mu0_day             = real1d("mu0_day",             ncol);
+            workspace.p_lay_day           = real2d("p_lay_day",           ncol, nlay);
+            workspace.t_lay_day           = real2d("t_lay_day",           ncol, nlay);
+            workspace.t_lay_limited       = real2d("t_lay_limited",       ncol, nlay);
+            workspace.vmr                 = real2d("vmr",                 ncol, nlay);
+            workspace.vmr_day             = real2d("vmr_day",             ncol, nlay);
+            workspace.p_lev_day           = real2d("p_lev_day",           ncol, nlay+1);
+            workspace.t_lev_day           = real2d("t_lev_day",           ncol, nlay+1);
+            workspace.flux_up_day         = real2d("flux_up_day",         ncol, nlay+1);
+            workspace.flux_dn_day         = real2d("flux_dn_day",         ncol, nlay+1);
+            workspace.flux_dn_dir_day     = real2d("flux_dn_dir_day",     ncol, nlay+1);
+            workspace.sfc_alb_dir_T       = real2d("sfc_alb_dir",         nbnd, ncol);
+            workspace.sfc_alb_dif_T       = real2d("sfc_alb_dif",         nbnd, ncol);
+            workspace.toa_flux            = real2d("toa_flux",            ncol, ngpt);
+            workspace.bnd_flux_up_day     = real3d("bnd_flux_up_day",     ncol, nlay+1, nbnd);
+            workspace.bnd_flux_dn_day     = real3d("bnd_flux_dn_day",     ncol, nlay+1, nbnd);
+            workspace.bnd_flux_dn_dir_day = real3d("bnd_flux_dn_dir_day", ncol, nlay+1, nbnd);
+            workspace.aer_tau_day         = real3d("aer_tau_day",         ncol, nlay, nbnd);
+            workspace.aer_ssa_day         = real3d("aer_ssa_day",         ncol, nlay, nbnd);
+            workspace.aer_g_day           = real3d("aer_g_day",           ncol, nlay, nbnd);
+            workspace.cld_tau_day         = real3d("cld_tau_day",         ncol, nlay, ngpt);
+            workspace.cld_ssa_day         = real3d("cld_ssa_day",         ncol, nlay, ngpt);
+            workspace.cld_g_day           = real3d("cld_g_day",           ncol, nlay, ngpt);
+            workspace.optics_tau          = real3d("optics_tau",          ncol, nlay, ngpt);
+            workspace.optics_ssa          = real3d("optics_ssa",          ncol, nlay, ngpt);
+            workspace.optics_g            = real3d("optics_g",            ncol, nlay, ngpt);
+        }
+
+        // Views over the leading ncol columns of a (larger) workspace array.
+        // Since arrays are column-major, these entries are contiguous in memory.
+        static real1d leading_cols(const real1d &a, const int ncol) {
+            return real1d(a.label(), a.data(), ncol);
+        }
+        static real2d leading_cols(const real2d &a, const int ncol) {
+            return real2d(a.label(), a.data(), ncol, a.dimension[1]);
+        }
+        static real3d leading_cols(const real3d &a, const int ncol) {
+            return real3d(a.label(), a.data(), ncol, a.dimension[1], a.dimension[2]);
+        }
+
         void rrtmgp_sw(
                 const int ncol, const int nlay,
                 GasOpticsRRTMGP &k_dist,
@@ -575,7 +623,8 @@ namespace scream {
                 OpticalProps2str &aerosol, OpticalProps2str &clouds,
                 FluxesByband &fluxes, FluxesBroadband &clrsky_fluxes,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger) {
+                const std::shared_ptr<spdlog::logger>& logger,
+                SWDaytimeWorkspace* workspace) {
 
             // Get problem sizes
             int nbnd = k_dist.get_nband();
@@ -607,43 +656,52 @@ namespace scream {
                 bnd_flux_dn    (icol,ilev,ibnd) = 0;
                 bnd_flux_dn_dir(icol,ilev,ibnd) = 0;
             });
- 
-            // Get daytime indices
-            auto dayIndices = int1d("dayIndices", ncol);
-            memset(dayIndices, -1);
-            // Loop below has to be done on host, so create host copies
-            // TODO: there is probably a way to do this on the device
-            auto dayIndices_h = dayIndices.createHostCopy();
-            auto mu0_h = mu0.createHostCopy();
+
+            // If the caller did not provide scratch storage, allocate it here
+            SWDaytimeWorkspace local_workspace;
+            if (workspace==nullptr) {
+                alloc_sw_daytime_workspace(local_workspace, ncol, nlay, nbnd, ngpt);
+                workspace = &local_workspace;
+            }
+            auto& ws = *workspace;
+            EKAT_REQUIRE_MSG (ws.day_indices.totElems()>=ncol,
+                "Error! SW daytime workspace is too small for the input number of columns.\n");
+
+            // Get daytime indices, compacting the (1-based) indices of the columns
+            // with mu0>0 at the front of dayIndices with a device scan.
+            auto dayIndices = int1d("dayIndices", ws.day_indices.data(), ncol);
+            auto mu0_ptr = mu0.data();
+            auto day_idx_ptr = dayIndices.data();
             int nday = 0;
-            for (int icol = 1; icol <= ncol; icol++) {
-                if (mu0_h(icol) > 0) {
-                    nday++;
-                    dayIndices_h(nday) = icol;
+            yakl::fence();
+            Kokkos::parallel_scan(Kokkos::RangePolicy<>(0,ncol), KOKKOS_LAMBDA(const int i, int& update, const bool final) {
+                if (mu0_ptr[i] > 0) {
+                    if (final) {
+                        day_idx_ptr[update] = i+1;
+                    }
+                    ++update;
                 }
-            }
-            // Copy data back to the device
-            dayIndices_h.deep_copy_to(dayIndices);
+            }, nday);
             if (nday == 0) { 
                 // No daytime columns in this chunk, skip the rest of this routine
                 return;
             }
 
             // Subset mu0
-            auto mu0_day = real1d("mu0_day", nday);
+            auto mu0_day = leading_cols(ws.mu0_day, nday);
             parallel_for(SimpleBounds<1>(nday), YAKL_LAMBDA(int iday) {
                 mu0_day(iday) = mu0(dayIndices(iday));
             });
 
             // subset state variables
-            auto p_lay_day = real2d("p_lay_day", nday, nlay);
-            auto t_lay_day = real2d("t_lay_day", nday, nlay);
+            auto p_lay_day = leading_cols(ws.p_lay_day, nday);
+            auto t_lay_day = leading_cols(ws.t_lay_day, nday);
             parallel_for(SimpleBounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
                 p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
                 t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
             });
-            auto p_lev_day = real2d("p_lev_day", nday, nlay+1);
-            auto t_lev_day = real2d("t_lev_day", nday, nlay+1);
+            auto p_lev_day = leading_cols(ws.p_lev_day, nday);
+            auto t_lev_day = leading_cols(ws.t_lev_day, nday);
             parallel_for(SimpleBounds<2>(nlay+1,nday), YAKL_LAMBDA(int ilev, int iday) {
                 p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
                 t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
@@ -653,9 +711,9 @@ namespace scream {
             auto gas_names = gas_concs.get_gas_names();
             GasConcs gas_concs_day;
             gas_concs_day.init(gas_names, nday, nlay);
+            auto vmr_day = leading_cols(ws.vmr_day, nday);
+            auto vmr     = leading_cols(ws.vmr    , ncol);
             for (int igas = 1; igas <= ngas; igas++) {
-                auto vmr_day = real2d("vmr_day", nday, nlay);
-                auto vmr     = real2d("vmr"    , ncol, nlay);
                 gas_concs.get_vmr(gas_names(igas), vmr);
                 parallel_for(SimpleBounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
                     vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
@@ -666,7 +724,9 @@ namespace scream {
             // Subset aerosol optics
             OpticalProps2str aerosol_day;
             aerosol_day.init(k_dist.get_band_lims_wavenumber());
-            aerosol_day.alloc_2str(nday, nlay);
+            aerosol_day.tau = leading_cols(ws.aer_tau_day, nday);
+            aerosol_day.ssa = leading_cols(ws.aer_ssa_day, nday);
+            aerosol_day.g   = leading_cols(ws.aer_g_day  , nday);
             parallel_for(SimpleBounds<3>(nbnd,nlay,nday), YAKL_LAMBDA(int ibnd, int ilay, int iday) {
                 aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
                 aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
@@ -677,7 +737,9 @@ namespace scream {
             // TODO: nbnd -> ngpt once we pass sub-sampled cloud state
             OpticalProps2str clouds_day;
             clouds_day.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
-            clouds_day.alloc_2str(nday, nlay);
+            clouds_day.tau = leading_cols(ws.cld_tau_day, nday);
+            clouds_day.ssa = leading_cols(ws.cld_ssa_day, nday);
+            clouds_day.g   = leading_cols(ws.cld_g_day  , nday);
             parallel_for(SimpleBounds<3>(ngpt,nlay,nday), YAKL_LAMBDA(int igpt, int ilay, int iday) {
                 clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
                 clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
@@ -687,20 +749,20 @@ namespace scream {
             // RRTMGP assumes surface albedos have a screwy dimension ordering
             // for some strange reason, so we need to transpose these; also do
             // daytime subsetting in the same kernel
-            real2d sfc_alb_dir_T("sfc_alb_dir", nbnd, nday);
-            real2d sfc_alb_dif_T("sfc_alb_dif", nbnd, nday);
+            real2d sfc_alb_dir_T("sfc_alb_dir", ws.sfc_alb_dir_T.data(), nbnd, nday);
+            real2d sfc_alb_dif_T("sfc_alb_dif", ws.sfc_alb_dif_T.data(), nbnd, nday);
             parallel_for(SimpleBounds<2>(nbnd,nday), YAKL_LAMBDA(int ibnd, int icol) {
                 sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(dayIndices(icol),ibnd);
                 sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(dayIndices(icol),ibnd);
             });
 
             // Temporaries we need for daytime-only fluxes
-            auto flux_up_day = real2d("flux_up_day", nday, nlay+1);
-            auto flux_dn_day = real2d("flux_dn_day", nday, nlay+1);
-            auto flux_dn_dir_day = real2d("flux_dn_dir_day", nday, nlay+1);
-            auto bnd_flux_up_day = real3d("bnd_flux_up_day", nday, nlay+1, nbnd);
-            auto bnd_flux_dn_day = real3d("bnd_flux_dn_day", nday, nlay+1, nbnd);
-            auto bnd_flux_dn_dir_day = real3d("bnd_flux_dn_dir_day", nday, nlay+1, nbnd);
+            auto flux_up_day = leading_cols(ws.flux_up_day, nday);
+            auto flux_dn_day = leading_cols(ws.flux_dn_day, nday);
+            auto flux_dn_dir_day = leading_cols(ws.flux_dn_dir_day, nday);
+            auto bnd_flux_up_day = leading_cols(ws.bnd_flux_up_day, nday);
+            auto bnd_flux_dn_day = leading_cols(ws.bnd_flux_dn_day, nday);
+            auto bnd_flux_dn_dir_day = leading_cols(ws.bnd_flux_dn_dir_day, nday);
             FluxesByband fluxes_day;
             fluxes_day.flux_up         = flux_up_day;
             fluxes_day.flux_dn         = flux_dn_day;
@@ -709,18 +771,25 @@ namespace scream {
             fluxes_day.bnd_flux_dn     = bnd_flux_dn_day;
             fluxes_day.bnd_flux_dn_dir = bnd_flux_dn_dir_day;
 
-            // Allocate space for optical properties
+            // Optical properties live in the workspace too
             OpticalProps2str optics;
-            optics.alloc_2str(nday, nlay, k_dist);
+            optics.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
+            optics.tau = leading_cols(ws.optics_tau, nday);
+            optics.ssa = leading_cols(ws.optics_ssa, nday);
+            optics.g   = leading_cols(ws.optics_g  , nday);
 
             // Limit temperatures for gas optics look-up tables
-            auto t_lay_limited = real2d("t_lay_limited", nday, nlay);
+            auto t_lay_limited = leading_cols(ws.t_lay_limited, nday);
             limit_to_bounds(t_lay_day, k_dist_sw.get_temp_min(), k_dist_sw.get_temp_max(), t_lay_limited);
 
-            // Do gas optics
-            real2d toa_flux("toa_flux", nday, ngpt);
-            auto p_lay_host = p_lay.createHostCopy();
-            bool top_at_1 = p_lay_host(1, 1) < p_lay_host(1, nlay);
+            // Do gas optics. To figure out the vertical ordering, we only need
+            // p_lay(1,1) and p_lay(1,nlay), so avoid copying the whole array to host.
+            auto toa_flux = leading_cols(ws.toa_flux, nday);
+            using uview_0d = Kokkos::View<const Real, Kokkos::MemoryUnmanaged>;
+            Real p_lay_top, p_lay_bot;
+            Kokkos::deep_copy(p_lay_top, uview_0d(p_lay.data()));
+            Kokkos::deep_copy(p_lay_bot, uview_0d(p_lay.data() + (nlay-1)*p_lay.dimension[0]));
+            bool top_at_1 = p_lay_top < p_lay_bot;
 
             k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, optics, toa_flux);
 
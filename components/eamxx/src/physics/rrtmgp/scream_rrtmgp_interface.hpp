@@ -56,6 +56,55 @@ namespace scream {
                 real3d &sw_bnd_flux_dir , real3d &sw_bnd_flux_dif ,
                 real1d &sfc_flux_dir_vis, real1d &sfc_flux_dir_nir,
                 real1d &sfc_flux_dif_vis, real1d &sfc_flux_dif_nir);
+        /*
+         * Scratch storage for the daytime-column subsetting done in rrtmgp_sw.
+         * Arrays are sized for the max number of columns passed to rrtmgp_sw
+         * (e.g., the column chunk size), and rrtmgp_sw only uses their leading
+         * nday columns. If the caller does not provide one, rrtmgp_sw allocates
+         * a workspace on every call.
+         */
+        struct SWDaytimeWorkspace {
+            // (ncol)
+            int1d  day_indices;
+            real1d mu0_day;
+            // (ncol, nlay)
+            real2d p_lay_day;
+            real2d t_lay_day;
+            real2d t_lay_limited;
+            real2d vmr;
+            real2d vmr_day;
+            // (ncol, nlay+1)
+            real2d p_lev_day;
+            real2d t_lev_day;
+            real2d flux_up_day;
+            real2d flux_dn_day;
+            real2d flux_dn_dir_day;
+            // (nbnd, ncol), transposed as expected by rte_sw
+            real2d sfc_alb_dir_T;
+            real2d sfc_alb_dif_T;
+            // (ncol, ngpt)
+            real2d toa_flux;
+            // (ncol, nlay+1, nbnd)
+            real3d bnd_flux_up_day;
+            real3d bnd_flux_dn_day;
+            real3d bnd_flux_dn_dir_day;
+            // (ncol, nlay, nbnd)
+            real3d aer_tau_day;
+            real3d aer_ssa_day;
+            real3d aer_g_day;
+            // (ncol, nlay, ngpt)
+            real3d cld_tau_day;
+            real3d cld_ssa_day;
+            real3d cld_g_day;
+            real3d optics_tau;
+            real3d optics_ssa;
+            real3d optics_g;
+        };
+        /*
+         * Allocate a daytime workspace that can hold up to ncol columns.
+         */
+        extern void alloc_sw_daytime_workspace(SWDaytimeWorkspace &workspace,
+                const int ncol, const int nlay, const int nbnd, const int ngpt);
         /*
          * Main driver code to run RRTMGP.
          * The input logger is in charge of outputing info to
@@ -76,7 +125,8 @@ namespace scream {
                 real3d &sw_bnd_flux_up, real3d &sw_bnd_flux_dn, real3d &sw_bnd_flux_dn_dir,
                 real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger);
+                const std::shared_ptr<spdlog::logger>& logger,
+                SWDaytimeWorkspace* sw_workspace = nullptr);
         /*
          * Perform any clean-up tasks
          */
@@ -91,7 +141,8 @@ namespace scream {
                 real2d &sfc_alb_dir, real2d &sfc_alb_dif, real1d &mu0,
                 OpticalProps2str &aerosol, OpticalProps2str &clouds,
                 FluxesByband &fluxes, FluxesBroadband &clrsky_fluxes, const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger);
+                const std::shared_ptr<spdlog::logger>& logger,
+                SWDaytimeWorkspace* workspace = nullptr);
         /*
          * Longwave driver (called by rrtmgp_main)
          */
@@ -16,6 +16,19 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+
+  // Kernel granularity: 'default' uses the build default (SCREAM_SMALL_KERNELS)
+  const auto granularity = m_params.get<std::string>("kernel_granularity","default");
+  EKAT_REQUIRE_MSG (granularity=="default" || granularity=="monolithic" ||
+                    granularity=="small_kernels" || granularity=="autotune",
+      "Error! Invalid value for SHOC kernel_granularity.\n"
+      "  - value: " + granularity + "\n"
+      "  - valid values: default, monolithic, small_kernels, autotune\n");
+  m_small_kernels = granularity=="default" ? SHF::small_kernels_default
+                                           : granularity=="small_kernels";
+  m_autotune_steps = granularity=="autotune" ? m_params.get<int>("kernel_autotune_steps",3) : 0;
+  EKAT_REQUIRE_MSG (granularity!="autotune" || m_autotune_steps>0,
+      "Error! SHOC kernel_autotune_steps must be positive.\n");
 }
 
 // =========================================================================================
@@ -155,11 +168,9 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   using scalar_view_t = decltype(m_buffer.cell_length);
   scalar_view_t* _1d_scalar_view_ptrs[Buffer::num_1d_scalar_ncol] =
     {&m_buffer.cell_length, &m_buffer.wpthlp_sfc, &m_buffer.wprtp_sfc, &m_buffer.upwp_sfc, &m_buffer.vpwp_sfc
-#ifdef SCREAM_SMALL_KERNELS
      , &m_buffer.se_b, &m_buffer.ke_b, &m_buffer.wv_b, &m_buffer.wl_b
      , &m_buffer.se_a, &m_buffer.ke_a, &m_buffer.wv_a, &m_buffer.wl_a
      , &m_buffer.ustar, &m_buffer.kbfs, &m_buffer.obklen, &m_buffer.ustar2, &m_buffer.wstar
-#endif
     };
   for (int i = 0; i < Buffer::num_1d_scalar_ncol; ++i) {
     *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_num_cols);
@@ -181,18 +192,14 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
     &m_buffer.z_mid, &m_buffer.rrho, &m_buffer.thv, &m_buffer.dz, &m_buffer.zt_grid, &m_buffer.wm_zt,
     &m_buffer.inv_exner, &m_buffer.thlm, &m_buffer.qw, &m_buffer.dse, &m_buffer.tke_copy, &m_buffer.qc_copy,
     &m_buffer.shoc_ql2, &m_buffer.shoc_mix, &m_buffer.isotropy, &m_buffer.w_sec, &m_buffer.wqls_sec, &m_buffer.brunt
-#ifdef SCREAM_SMALL_KERNELS
     , &m_buffer.rho_zt, &m_buffer.shoc_qv, &m_buffer.dz_zt, &m_buffer.tkh
-#endif
   };
 
   spack_2d_view_t* _2d_spack_int_view_ptrs[Buffer::num_2d_vector_int] = {
     &m_buffer.z_int, &m_buffer.rrho_i, &m_buffer.zi_grid, &m_buffer.thl_sec, &m_buffer.qw_sec,
     &m_buffer.qwthl_sec, &m_buffer.wthl_sec, &m_buffer.wqw_sec, &m_buffer.wtke_sec, &m_buffer.uw_sec,
     &m_buffer.vw_sec, &m_buffer.w3
-#ifdef SCREAM_SMALL_KERNELS
     , &m_buffer.dz_zi
-#endif
   };
 
   for (int i = 0; i < Buffer::num_2d_vector_mid; ++i) {
@@ -338,7 +345,6 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   history_output.wqls_sec  = m_buffer.wqls_sec;
   history_output.brunt     = m_buffer.brunt;
 
-#ifdef SCREAM_SMALL_KERNELS
   temporaries.se_b = m_buffer.se_b;
   temporaries.ke_b = m_buffer.ke_b;
   temporaries.wv_b = m_buffer.wv_b;
@@ -358,7 +364,6 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   temporaries.dz_zt = m_buffer.dz_zt;
   temporaries.dz_zi = m_buffer.dz_zi;
   temporaries.tkh = m_buffer.tkh;
-#endif
 
   shoc_postprocess.set_variables(m_num_cols,m_num_levs,m_num_tracers,
                                  rrho,qv,qw,qc,qc_copy,tke,tke_copy,qtracers,shoc_ql2,
@@ -441,13 +446,28 @@ void SHOCMacrophysics::run_impl (const double dt)
   // Reset internal WSM variables.
   workspace_mgr.reset_internals();
 
+  // While autotuning, alternate between the two kernel granularities.
+  // They are BFB with each other, so this does not change the answers.
+  const bool autotuning = m_autotune_step<2*m_autotune_steps;
+  const bool small_kernels = autotuning ? (m_autotune_step%2==1) : m_small_kernels;
+
   // Run shoc main
-  SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,input,input_output,output,history_output
-#ifdef SCREAM_SMALL_KERNELS
-                 , temporaries
-#endif
-                 );
+  const auto elapsed_usec =
+    SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
+                   workspace_mgr,input,input_output,output,history_output,
+                   temporaries,small_kernels);
+
+  if (autotuning) {
+    // The min over the steps filters out the first-call overheads
+    auto& best = m_autotune_usec[small_kernels ? 1 : 0];
+    best = best<0 ? elapsed_usec : std::min(best,elapsed_usec);
+    if (++m_autotune_step==2*m_autotune_steps) {
+      m_small_kernels = m_autotune_usec[1]<m_autotune_usec[0];
+      m_atm_logger->info("[SHOC] kernel autotuning: monolithic " + std::to_string(m_autotune_usec[0]) +
+                         " us, small kernels " + std::to_string(m_autotune_usec[1]) + " us; using " +
+                         (m_small_kernels ? "small kernels" : "monolithic") + " for the rest of the run.\n");
+    }
+  }
 
   // Postprocessing of SHOC outputs
   Kokkos::parallel_for("shoc_postprocess",
@@ -388,19 +388,12 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-#ifndef SCREAM_SMALL_KERNELS
-    static constexpr int num_1d_scalar_ncol = 5;
-#else
+    // The granularity of the SHOC kernels is chosen at run time,
+    // so the small kernels temporaries are always allocated
     static constexpr int num_1d_scalar_ncol = 18;
-#endif
     static constexpr int num_1d_scalar_nlev = 1;
-#ifndef SCREAM_SMALL_KERNELS
-    static constexpr int num_2d_vector_mid  = 18;
-    static constexpr int num_2d_vector_int  = 12;
-#else
     static constexpr int num_2d_vector_mid  = 22;
     static constexpr int num_2d_vector_int  = 13;
-#endif
     static constexpr int num_2d_vector_tr   = 1;
 
     uview_1d<Real> cell_length;
@@ -408,7 +401,6 @@ public:
     uview_1d<Real> wprtp_sfc;
     uview_1d<Real> upwp_sfc;
     uview_1d<Real> vpwp_sfc;
-#ifdef SCREAM_SMALL_KERNELS
     uview_1d<Real> se_b;
     uview_1d<Real> ke_b;
     uview_1d<Real> wv_b;
@@ -422,7 +414,6 @@ public:
     uview_1d<Real> obklen;
     uview_1d<Real> ustar2;
     uview_1d<Real> wstar;
-#endif
 
     uview_1d<Spack> pref_mid;
 
@@ -457,13 +448,11 @@ public:
     uview_2d<Spack> w3;
     uview_2d<Spack> wqls_sec;
     uview_2d<Spack> brunt;
-#ifdef SCREAM_SMALL_KERNELS
     uview_2d<Spack> rho_zt;
     uview_2d<Spack> shoc_qv;
     uview_2d<Spack> dz_zt;
     uview_2d<Spack> dz_zi;
     uview_2d<Spack> tkh;
-#endif
 
     Spack* wsm_data;
   };
@@ -510,9 +499,15 @@ protected:
   SHF::SHOCInputOutput input_output;
   SHF::SHOCOutput output;
   SHF::SHOCHistoryOutput history_output;
-#ifdef SCREAM_SMALL_KERNELS
   SHF::SHOCTemporaries temporaries;
-#endif
+
+  // Kernel granularity: run SHOC as small kernels rather than one monolithic kernel.
+  // With autotuning, the first 2*m_autotune_steps steps alternate between the two,
+  // and the fastest (min time over its steps) is kept for the rest of the run.
+  bool m_small_kernels;
+  int  m_autotune_steps;
+  int  m_autotune_step = 0;
+  Int  m_autotune_usec[2] = {-1, -1};
 
   // Structures which compute pre/post process
   SHOCPreprocess shoc_preprocess;
@@ -3,6 +3,7 @@
 
 #include "shoc_functions.hpp" // for ETI only but harmless for GPU
 
+#include "ekat/ekat_assert.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
 #include <iomanip>
@@ -61,7 +62,6 @@ Int Functions<S,D>::shoc_init(
   return host_view(0);
 }
 
-#ifndef SCREAM_SMALL_KERNELS
 template<typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>::shoc_main_internal(
@@ -287,7 +287,6 @@ void Functions<S,D>::shoc_main_internal(
   workspace.template release_many_contiguous<5>(
     {&rho_zt, &shoc_qv, &dz_zt, &dz_zi, &tkh});
 }
-#else
 template<typename S, typename D>
 void Functions<S,D>::shoc_main_internal(
   const Int&                   shcol,        // Number of columns
@@ -511,7 +510,6 @@ void Functions<S,D>::shoc_main_internal(
                workspace_mgr,                  // Workspace mgr
                pblh);                          // Output
 }
-#endif
 
 template<typename S, typename D>
 Int Functions<S,D>::shoc_main(
@@ -526,113 +524,115 @@ Int Functions<S,D>::shoc_main(
   const SHOCInput&         shoc_input,          // Input
   const SHOCInputOutput&   shoc_input_output,   // Input/Output
   const SHOCOutput&        shoc_output,         // Output
-  const SHOCHistoryOutput& shoc_history_output  // Output (diagnostic)
-#ifdef SCREAM_SMALL_KERNELS
-  , const SHOCTemporaries& shoc_temporaries     // Temporaries for small kernels
-#endif
-                              )
+  const SHOCHistoryOutput& shoc_history_output, // Output (diagnostic)
+  const SHOCTemporaries&   shoc_temporaries,    // Temporaries, only used with small kernels
+  const bool               small_kernels)
 {
   // Start timer
   auto start = std::chrono::steady_clock::now();
 
-#ifndef SCREAM_SMALL_KERNELS
-  using ExeSpace = typename KT::ExeSpace;
-
-  // SHOC main loop
-  const auto nlev_packs = ekat::npack<Spack>(nlev);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-    const Int i = team.league_rank();
-
-    auto workspace = workspace_mgr.get_workspace(team);
-
-    const Scalar dx_s{shoc_input.dx(i)};
-    const Scalar dy_s{shoc_input.dy(i)};
-    const Scalar wthl_sfc_s{shoc_input.wthl_sfc(i)};
-    const Scalar wqw_sfc_s{shoc_input.wqw_sfc(i)};
-    const Scalar uw_sfc_s{shoc_input.uw_sfc(i)};
-    const Scalar vw_sfc_s{shoc_input.vw_sfc(i)};
-    const Scalar phis_s{shoc_input.phis(i)};
-    Scalar pblh_s{0};
-
-    const auto zt_grid_s      = ekat::subview(shoc_input.zt_grid, i);
-    const auto zi_grid_s      = ekat::subview(shoc_input.zi_grid, i);
-    const auto pres_s         = ekat::subview(shoc_input.pres, i);
-    const auto presi_s        = ekat::subview(shoc_input.presi, i);
-    const auto pdel_s         = ekat::subview(shoc_input.pdel, i);
-    const auto thv_s          = ekat::subview(shoc_input.thv, i);
-    const auto w_field_s      = ekat::subview(shoc_input.w_field, i);
-    const auto wtracer_sfc_s  = ekat::subview(shoc_input.wtracer_sfc, i);
-    const auto inv_exner_s    = ekat::subview(shoc_input.inv_exner, i);
-    const auto host_dse_s     = ekat::subview(shoc_input_output.host_dse, i);
-    const auto tke_s          = ekat::subview(shoc_input_output.tke, i);
-    const auto thetal_s       = ekat::subview(shoc_input_output.thetal, i);
-    const auto qw_s           = ekat::subview(shoc_input_output.qw, i);
-    const auto wthv_sec_s     = ekat::subview(shoc_input_output.wthv_sec, i);
-    const auto tk_s           = ekat::subview(shoc_input_output.tk, i);
-    const auto shoc_cldfrac_s = ekat::subview(shoc_input_output.shoc_cldfrac, i);
-    const auto shoc_ql_s      = ekat::subview(shoc_input_output.shoc_ql, i);
-    const auto shoc_ql2_s     = ekat::subview(shoc_output.shoc_ql2, i);
-    const auto shoc_mix_s     = ekat::subview(shoc_history_output.shoc_mix, i);
-    const auto w_sec_s        = ekat::subview(shoc_history_output.w_sec, i);
-    const auto thl_sec_s      = ekat::subview(shoc_history_output.thl_sec, i);
-    const auto qw_sec_s       = ekat::subview(shoc_history_output.qw_sec, i);
-    const auto qwthl_sec_s    = ekat::subview(shoc_history_output.qwthl_sec, i);
-    const auto wthl_sec_s     = ekat::subview(shoc_history_output.wthl_sec, i);
-    const auto wqw_sec_s      = ekat::subview(shoc_history_output.wqw_sec, i);
-    const auto wtke_sec_s     = ekat::subview(shoc_history_output.wtke_sec, i);
-    const auto uw_sec_s       = ekat::subview(shoc_history_output.uw_sec, i);
-    const auto vw_sec_s       = ekat::subview(shoc_history_output.vw_sec, i);
-    const auto w3_s           = ekat::subview(shoc_history_output.w3, i);
-    const auto wqls_sec_s     = ekat::subview(shoc_history_output.wqls_sec, i);
-    const auto brunt_s        = ekat::subview(shoc_history_output.brunt, i);
-    const auto isotropy_s     = ekat::subview(shoc_history_output.isotropy, i);
-
-    const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, i, 0, Kokkos::ALL());
-    const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, i, 1, Kokkos::ALL());
-    const auto qtracers_s = Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL());
-
-    shoc_main_internal(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
-                       dx_s, dy_s, zt_grid_s, zi_grid_s,                      // Input
-                       pres_s, presi_s, pdel_s, thv_s, w_field_s,             // Input
-                       wthl_sfc_s, wqw_sfc_s, uw_sfc_s, vw_sfc_s,             // Input
-                       wtracer_sfc_s, inv_exner_s, phis_s,                    // Input
-                       workspace,                                             // Workspace
-                       host_dse_s, tke_s, thetal_s, qw_s, u_wind_s, v_wind_s, // Input/Output
-                       wthv_sec_s, qtracers_s, tk_s, shoc_cldfrac_s,          // Input/Output
-                       shoc_ql_s,                                             // Input/Output
-                       pblh_s, shoc_ql2_s,                                    // Output
-                       shoc_mix_s, w_sec_s, thl_sec_s, qw_sec_s, qwthl_sec_s, // Diagnostic Output Variables
-                       wthl_sec_s, wqw_sec_s, wtke_sec_s, uw_sec_s, vw_sec_s, // Diagnostic Output Variables
-                       w3_s, wqls_sec_s, brunt_s, isotropy_s);                // Diagnostic Output Variables
-
-    shoc_output.pblh(i) = pblh_s;
-  });
-  Kokkos::fence();
-#else
-  const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 0, Kokkos::ALL());
-  const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 1, Kokkos::ALL());
-
-  shoc_main_internal(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
-    shoc_input.dx, shoc_input.dy, shoc_input.zt_grid, shoc_input.zi_grid, // Input
-    shoc_input.pres, shoc_input.presi, shoc_input.pdel, shoc_input.thv, shoc_input.w_field, // Input
-    shoc_input.wthl_sfc, shoc_input.wqw_sfc, shoc_input.uw_sfc, shoc_input.vw_sfc, // Input
-    shoc_input.wtracer_sfc, shoc_input.inv_exner, shoc_input.phis, // Input
-    workspace_mgr, // Workspace Manager
-    shoc_input_output.host_dse, shoc_input_output.tke, shoc_input_output.thetal, shoc_input_output.qw, u_wind_s, v_wind_s, // Input/Output
-    shoc_input_output.wthv_sec, shoc_input_output.qtracers, shoc_input_output.tk, shoc_input_output.shoc_cldfrac, // Input/Output
-    shoc_input_output.shoc_ql, // Input/Output
-    shoc_output.pblh, shoc_output.shoc_ql2, // Output
-    shoc_history_output.shoc_mix, shoc_history_output.w_sec, shoc_history_output.thl_sec, shoc_history_output.qw_sec, shoc_history_output.qwthl_sec, // Diagnostic Output Variables
-    shoc_history_output.wthl_sec, shoc_history_output.wqw_sec, shoc_history_output.wtke_sec, shoc_history_output.uw_sec, shoc_history_output.vw_sec, // Diagnostic Output Variables
-    shoc_history_output.w3, shoc_history_output.wqls_sec, shoc_history_output.brunt, shoc_history_output.isotropy, // Diagnostic Output Variables
-    // Temporaries
-    shoc_temporaries.se_b, shoc_temporaries.ke_b, shoc_temporaries.wv_b, shoc_temporaries.wl_b,
-    shoc_temporaries.se_a, shoc_temporaries.ke_a, shoc_temporaries.wv_a, shoc_temporaries.wl_a,
-    shoc_temporaries.ustar, shoc_temporaries.kbfs, shoc_temporaries.obklen, shoc_temporaries.ustar2,
-    shoc_temporaries.wstar, shoc_temporaries.rho_zt, shoc_temporaries.shoc_qv, shoc_temporaries.dz_zt,
-    shoc_temporaries.dz_zi, shoc_temporaries.tkh);
-#endif
+  if (!small_kernels) {
+    using ExeSpace = typename KT::ExeSpace;
+
+    // SHOC main loop
+    const auto nlev_packs = ekat::npack<Spack>(nlev);
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+
+      auto workspace = workspace_mgr.get_workspace(team);
+
+      const Scalar dx_s{shoc_input.dx(i)};
+      const Scalar dy_s{shoc_input.dy(i)};
+      const Scalar wthl_sfc_s{shoc_input.wthl_sfc(i)};
+      const Scalar wqw_sfc_s{shoc_input.wqw_sfc(i)};
+      const Scalar uw_sfc_s{shoc_input.uw_sfc(i)};
+      const Scalar vw_sfc_s{shoc_input.vw_sfc(i)};
+      const Scalar phis_s{shoc_input.phis(i)};
+      Scalar pblh_s{0};
+
+      const auto zt_grid_s      = ekat::subview(shoc_input.zt_grid, i);
+      const auto zi_grid_s      = ekat::subview(shoc_input.zi_grid, i);
+      const auto pres_s         = ekat::subview(shoc_input.pres, i);
+      const auto presi_s        = ekat::subview(shoc_input.presi, i);
+      const auto pdel_s         = ekat::subview(shoc_input.pdel, i);
+      const auto thv_s          = ekat::subview(shoc_input.thv, i);
+      const auto w_field_s      = ekat::subview(shoc_input.w_field, i);
+      const auto wtracer_sfc_s  = ekat::subview(shoc_input.wtracer_sfc, i);
+      const auto inv_exner_s    = ekat::subview(shoc_input.inv_exner, i);
+      const auto host_dse_s     = ekat::subview(shoc_input_output.host_dse, i);
+      const auto tke_s          = ekat::subview(shoc_input_output.tke, i);
+      const auto thetal_s       = ekat::subview(shoc_input_output.thetal, i);
+      const auto qw_s           = ekat::subview(shoc_input_output.qw, i);
+      const auto wthv_sec_s     = ekat::subview(shoc_input_output.wthv_sec, i);
+      const auto tk_s           = ekat::subview(shoc_input_output.tk, i);
+      const auto shoc_cldfrac_s = ekat::subview(shoc_input_output.shoc_cldfrac, i);
+      const auto shoc_ql_s      = ekat::subview(shoc_input_output.shoc_ql, i);
+      const auto shoc_ql2_s     = ekat::subview(shoc_output.shoc_ql2, i);
+      const auto shoc_mix_s     = ekat::subview(shoc_history_output.shoc_mix, i);
+      const auto w_sec_s        = ekat::subview(shoc_history_output.w_sec, i);
+      const auto thl_sec_s      = ekat::subview(shoc_history_output.thl_sec, i);
+      const auto qw_sec_s       = ekat::subview(shoc_history_output.qw_sec, i);
+      const auto qwthl_sec_s    = ekat::subview(shoc_history_output.qwthl_sec, i);
+      const auto wthl_sec_s     = ekat::subview(shoc_history_output.wthl_sec, i);
+      const auto wqw_sec_s      = ekat::subview(shoc_history_output.wqw_sec, i);
+      const auto wtke_sec_s     = ekat::subview(shoc_history_output.wtke_sec, i);
+      const auto uw_sec_s       = ekat::subview(shoc_history_output.uw_sec, i);
+      const auto vw_sec_s       = ekat::subview(shoc_history_output.vw_sec, i);
+      const auto w3_s           = ekat::subview(shoc_history_output.w3, i);
+      const auto wqls_sec_s     = ekat::subview(shoc_history_output.wqls_sec, i);
+      const auto brunt_s        = ekat::subview(shoc_history_output.brunt, i);
+      const auto isotropy_s     = ekat::subview(shoc_history_output.isotropy, i);
+
+      const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, i, 0, Kokkos::ALL());
+      const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, i, 1, Kokkos::ALL());
+      const auto qtracers_s = Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL());
+
+      shoc_main_internal(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+                         dx_s, dy_s, zt_grid_s, zi_grid_s,                      // Input
+                         pres_s, presi_s, pdel_s, thv_s, w_field_s,             // Input
+                         wthl_sfc_s, wqw_sfc_s, uw_sfc_s, vw_sfc_s,             // Input
+                         wtracer_sfc_s, inv_exner_s, phis_s,                    // Input
+                         workspace,                                             // Workspace
+                         host_dse_s, tke_s, thetal_s, qw_s, u_wind_s, v_wind_s, // Input/Output
+                         wthv_sec_s, qtracers_s, tk_s, shoc_cldfrac_s,          // Input/Output
+                         shoc_ql_s,                                             // Input/Output
+                         pblh_s, shoc_ql2_s,                                    // Output
+                         shoc_mix_s, w_sec_s, thl_sec_s, qw_sec_s, qwthl_sec_s, // Diagnostic Output Variables
+                         wthl_sec_s, wqw_sec_s, wtke_sec_s, uw_sec_s, vw_sec_s, // Diagnostic Output Variables
+                         w3_s, wqls_sec_s, brunt_s, isotropy_s);                // Diagnostic Output Variables
+
+      shoc_output.pblh(i) = pblh_s;
+    });
+    Kokkos::fence();
+  } else {
+    EKAT_REQUIRE_MSG (shoc_temporaries.tkh.size()>0,
+        "Error! SHOC small kernels require the temporaries to be allocated.\n");
+
+    const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 0, Kokkos::ALL());
+    const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 1, Kokkos::ALL());
+
+    shoc_main_internal(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+      shoc_input.dx, shoc_input.dy, shoc_input.zt_grid, shoc_input.zi_grid, // Input
+      shoc_input.pres, shoc_input.presi, shoc_input.pdel, shoc_input.thv, shoc_input.w_field, // Input
+      shoc_input.wthl_sfc, shoc_input.wqw_sfc, shoc_input.uw_sfc, shoc_input.vw_sfc, // Input
+      shoc_input.wtracer_sfc, shoc_input.inv_exner, shoc_input.phis, // Input
+      workspace_mgr, // Workspace Manager
+      shoc_input_output.host_dse, shoc_input_output.tke, shoc_input_output.thetal, shoc_input_output.qw, u_wind_s, v_wind_s, // Input/Output
+      shoc_input_output.wthv_sec, shoc_input_output.qtracers, shoc_input_output.tk, shoc_input_output.shoc_cldfrac, // Input/Output
+      shoc_input_output.shoc_ql, // Input/Output
+      shoc_output.pblh, shoc_output.shoc_ql2, // Output
+      shoc_history_output.shoc_mix, shoc_history_output.w_sec, shoc_history_output.thl_sec, shoc_history_output.qw_sec, shoc_history_output.qwthl_sec, // Diagnostic Output Variables
+      shoc_history_output.wthl_sec, shoc_history_output.wqw_sec, shoc_history_output.wtke_sec, shoc_history_output.uw_sec, shoc_history_output.vw_sec, // Diagnostic Output Variables
+      shoc_history_output.w3, shoc_history_output.wqls_sec, shoc_history_output.brunt, shoc_history_output.isotropy, // Diagnostic Output Variables
+      // Temporaries
+      shoc_temporaries.se_b, shoc_temporaries.ke_b, shoc_temporaries.wv_b, shoc_temporaries.wl_b,
+      shoc_temporaries.se_a, shoc_temporaries.ke_a, shoc_temporaries.wv_a, shoc_temporaries.wl_a,
+      shoc_temporaries.ustar, shoc_temporaries.kbfs, shoc_temporaries.obklen, shoc_temporaries.ustar2,
+      shoc_temporaries.wstar, shoc_temporaries.rho_zt, shoc_temporaries.shoc_qv, shoc_temporaries.dz_zt,
+      shoc_temporaries.dz_zi, shoc_temporaries.tkh);
+    Kokkos::fence();
+  }
 
   auto finish = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(finish - start);
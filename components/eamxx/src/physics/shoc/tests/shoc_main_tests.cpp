@@ -328,7 +328,7 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
 
   } // run_property
 
-  static void run_bfb()
+  static void run_bfb(const bool small_kernels)
   {
     auto engine = setup_random_test();
 
@@ -392,7 +392,7 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
                   d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql,
                   d.shoc_cldfrac, d.pblh, d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec,
                   d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec, d.wtke_sec, d.uw_sec,
-                  d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2);
+                  d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, small_kernels);
       d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
     }
 
@@ -491,7 +491,9 @@ TEST_CASE("shoc_main_bfb", "shoc")
 {
   using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestShocMain;
 
-  TestStruct::run_bfb();
+  // Both kernel granularities must be BFB with fortran
+  TestStruct::run_bfb(false);
+  TestStruct::run_bfb(true);
 }
 
 } // empty namespace
@@ -182,11 +182,22 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_start = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
 
+  // Open the SPA data file once for the whole run. If requested (and possible), the
+  // data for the next month is read in the background by the scorpio IO thread.
+  if (m_params.get<bool>("spa_async_prefetch",false)) {
+    const bool async = scorpio::start_io_thread();
+    if (not async) {
+      m_atm_logger->warn("[EAMxx::spa] WARNING: spa_async_prefetch was requested, but MPI was not\n"
+                         "   initialized with MPI_THREAD_MULTIPLE support. SPA data will be read synchronously.\n");
+    }
+  }
+  SPAFunc::init_spa_data_reader(m_spa_data_file,m_nswbands,m_nlwbands,SPAHorizInterp,m_dofs_gids.size(),SPADataReader);
+
   // Update the local time state information and load the first set of SPA data for interpolation:
   auto ts = timestamp();
   SPATimeState.inited = false;
   SPATimeState.current_month = ts.get_month();
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(ts,SPAHorizInterp,SPADataReader,SPATimeState,SPAData_start,SPAData_end);
 
   // Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -208,7 +219,7 @@ void SPA::run_impl (const double dt)
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
   /* Update time state and if the month has changed, update the data.*/
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(ts,SPAHorizInterp,SPADataReader,SPATimeState,SPAData_start,SPAData_end);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Pack**>();
@@ -219,7 +230,9 @@ void SPA::run_impl (const double dt)
 // =========================================================================================
 void SPA::finalize_impl()
 {
-  // Do nothing
+  // Wait for any pending prefetch, then close the SPA data file
+  scorpio::sync_io_tasks();
+  SPADataReader.input = nullptr;
 }
 
 } // namespace scream
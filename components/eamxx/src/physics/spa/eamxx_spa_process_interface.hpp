@@ -96,6 +96,7 @@ protected:
   // Structures to store the data used for interpolation
   SPAFunc::SPATimeState     SPATimeState;
   SPAFunc::SPAHorizInterp   SPAHorizInterp;
+  SPAFunc::SPADataReader    SPADataReader;
   SPAFunc::SPAInput         SPAData_start;
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
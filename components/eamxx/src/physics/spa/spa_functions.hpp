@@ -3,6 +3,7 @@
 
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/remap/horizontal_remap_utility.hpp"
+#include "share/io/scorpio_input.hpp"
 #include "share/scream_types.hpp"
 #include "share/util/scream_time_stamp.hpp"
 
@@ -160,6 +161,51 @@ struct SPAFunctions
     ekat::Comm m_comm;
 
   }; // SPAHorizInterp
+
+  struct SPADataReader {
+    // This structure stores everything needed to read the SPA data file and
+    // remap it horizontally: the input stream (which keeps the file and its IO
+    // decomposition open), and the buffers for the source data and for the
+    // remapped (but not yet padded) data. It is set up once, so that each
+    // monthly update only reads and remaps the data.
+    SPADataReader() = default;
+
+    // Basic dimensions of the source data
+    int ncols;      // Number of (unique) source columns needed by this rank
+    int nlevs;      // Number of levels in the file (i.e., without padding)
+    int nswbands;
+    int nlwbands;
+
+    // The input stream, reading into the host views below
+    std::shared_ptr<AtmosphereInput> input;
+
+    // The (zero-based) time index of the data in the host views, possibly still
+    // being read by a prefetch. A negative value means no data has been read yet.
+    int time_index_h = -1;
+
+    // Source data, as read from file
+    view_1d_host<Real> hyam_h;
+    view_1d_host<Real> hybm_h;
+    view_1d<Real> PS_v;
+    view_2d<Real> CCN3_v;
+    view_3d<Real> AER_G_SW_v;
+    view_3d<Real> AER_SSA_SW_v;
+    view_3d<Real> AER_TAU_SW_v;
+    view_3d<Real> AER_TAU_LW_v;
+    typename view_1d<Real>::HostMirror PS_v_h;
+    typename view_2d<Real>::HostMirror CCN3_v_h;
+    typename view_3d<Real>::HostMirror AER_G_SW_v_h;
+    typename view_3d<Real>::HostMirror AER_SSA_SW_v_h;
+    typename view_3d<Real>::HostMirror AER_TAU_SW_v_h;
+    typename view_3d<Real>::HostMirror AER_TAU_LW_v_h;
+
+    // Horizontally remapped data, before vertical padding
+    view_2d<Real> CCN3_unpad;
+    view_3d<Real> AER_G_SW_unpad;
+    view_3d<Real> AER_SSA_SW_unpad;
+    view_3d<Real> AER_TAU_SW_unpad;
+    view_3d<Real> AER_TAU_LW_unpad;
+  }; // SPADataReader
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
   static void spa_main(
@@ -182,6 +228,27 @@ struct SPAFunctions
     const view_1d<const gid_type>& dofs_gids,
           SPAHorizInterp&          spa_horiz_interp);
 
+  static void init_spa_data_reader(
+    const std::string&    spa_data_file_name,
+    const int             nswbands,
+    const int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+    const int             tgt_ncols,
+          SPADataReader&  spa_reader);
+
+  // Start reading the data at time_index into the reader's host views, in the
+  // background if the scorpio IO thread is running (immediately otherwise).
+  static void prefetch_spa_data(
+    const int             time_index,
+          SPADataReader&  spa_reader);
+
+  static void update_spa_data_from_file(
+    const int             time_index,
+          SPAHorizInterp& spa_horiz_interp,
+          SPADataReader&  spa_reader,
+          SPAInput&       spa_data);
+
+  // Same as above, but opens (and closes) the file for this read only
   static void update_spa_data_from_file(
     const std::string&    spa_data_file_name,
     const int             time_index,
@@ -191,11 +258,9 @@ struct SPAFunctions
           SPAInput&       spa_data);
 
   static void update_spa_timestate(
-    const std::string&     spa_data_file_name,
-    const int              nswbands,
-    const int              nlwbands,
     const util::TimeStamp& ts,
           SPAHorizInterp&  spa_horiz_interp,
+          SPADataReader&   spa_reader,
           SPATimeState&    time_state,
           SPAInput&        spa_beg,
           SPAInput&        spa_end);
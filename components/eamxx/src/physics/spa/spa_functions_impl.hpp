@@ -13,6 +13,7 @@
 #include "ekat/ekat_parse_yaml_file.hpp"
 
 #include <numeric>
+#include <utility>
 
 #include "share/util/scream_timing.hpp"
 /*-----------------------------------------------------------------
@@ -397,24 +398,43 @@ void SPAFunctions<S,D>
  */
 template<typename S, typename D>
 void SPAFunctions<S,D>
-::update_spa_data_from_file(
+::init_spa_data_reader(
     const std::string&          spa_data_file_name,
-    const int                   time_index, // zero-based
     const int                   nswbands,
     const int                   nlwbands,
-          SPAHorizInterp&       spa_horiz_interp,
-          SPAInput&             spa_data)
+    const SPAHorizInterp&       spa_horiz_interp,
+    const int                   tgt_ncols,
+          SPADataReader&        spa_reader)
 {
-  start_timer("EAMxx::SPA::update_spa_data_from_file");
+  start_timer("EAMxx::SPA::init_spa_data_reader");
   // Ensure all ranks are operating independently when reading the file, so there's a copy on all ranks
   auto comm = spa_horiz_interp.m_comm;
 
   // Use HorizontalMap to define the set of source column data we need to load
-  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  const auto& spa_horiz_map = spa_horiz_interp.horiz_map;
   auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
   const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
+
+  // Retrieve number of cols and levs on spa_data_file, and check the bands.
   scorpio::register_file(spa_data_file_name,scorpio::Read);
   const int source_data_nlevs = scorpio::get_dimlen(spa_data_file_name,"lev");
+  const int num_global_cols = scorpio::get_dimlen(spa_data_file_name,"ncol");
+  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen(spa_data_file_name,"swband"),
+      "ERROR init_spa_data_reader: Number of SW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),
+      "ERROR init_spa_data_reader: Number of LW bands in simulation doesn't match the SPA data file");
+  scorpio::eam_pio_closefile(spa_data_file_name);
+
+  spa_reader.ncols    = num_local_cols;
+  spa_reader.nlevs    = source_data_nlevs;
+  spa_reader.nswbands = nswbands;
+  spa_reader.nlwbands = nlwbands;
+  spa_reader.time_index_h = -1;
+
+  // Construct the grid needed for input:
+  auto grid = std::make_shared<PointGrid>("grid",num_local_cols,num_global_cols,source_data_nlevs,comm);
+  Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
+  grid->get_dofs_gids().sync_to_host();
 
   // Construct local arrays to read data into
   // Note, all of the views being created here are meant to hold the source resolution
@@ -424,48 +444,37 @@ void SPAFunctions<S,D>
   //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
   //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
   //   and so on for the other variables.
-  start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+  auto& r = spa_reader;
+  r.hyam_h = view_1d_host<Real>("hyam",source_data_nlevs);
+  r.hybm_h = view_1d_host<Real>("hybm",source_data_nlevs);
+  r.PS_v         = view_1d<Real>("PS",num_local_cols);
+  r.CCN3_v       = view_2d<Real>("CCN3",num_local_cols,source_data_nlevs);
+  r.AER_G_SW_v   = view_3d<Real>("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
+  r.AER_SSA_SW_v = view_3d<Real>("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
+  r.AER_TAU_SW_v = view_3d<Real>("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
+  r.AER_TAU_LW_v = view_3d<Real>("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
+
+  r.PS_v_h         = Kokkos::create_mirror_view(r.PS_v);
+  r.CCN3_v_h       = Kokkos::create_mirror_view(r.CCN3_v);
+  r.AER_G_SW_v_h   = Kokkos::create_mirror_view(r.AER_G_SW_v);
+  r.AER_SSA_SW_v_h = Kokkos::create_mirror_view(r.AER_SSA_SW_v);
+  r.AER_TAU_SW_v_h = Kokkos::create_mirror_view(r.AER_TAU_SW_v);
+  r.AER_TAU_LW_v_h = Kokkos::create_mirror_view(r.AER_TAU_LW_v);
+
+  // Temporary arrays to store the horizontally remapped data, before padding
+  r.CCN3_unpad       = view_2d<Real>("",tgt_ncols,source_data_nlevs);
+  r.AER_G_SW_unpad   = view_3d<Real>("",tgt_ncols,nswbands,source_data_nlevs);
+  r.AER_SSA_SW_unpad = view_3d<Real>("",tgt_ncols,nswbands,source_data_nlevs);
+  r.AER_TAU_SW_unpad = view_3d<Real>("",tgt_ncols,nswbands,source_data_nlevs);
+  r.AER_TAU_LW_unpad = view_3d<Real>("",tgt_ncols,nlwbands,source_data_nlevs);
+
+  // Set up input structure to read data from file.
   std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
   ekat::ParameterList spa_data_in_params;
   spa_data_in_params.set("Field Names",fnames);
   spa_data_in_params.set("Filename",spa_data_file_name);
   spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
-  
-  // Retrieve number of cols on spa_data_file.
-  scorpio::register_file(spa_data_file_name,scorpio::Read);
-  int num_global_cols = scorpio::get_dimlen(spa_data_file_name,"ncol");
-  scorpio::eam_pio_closefile(spa_data_file_name);
-
-  // Construct the grid needed for input:
-  auto grid = std::make_shared<PointGrid>("grid",num_local_cols,num_global_cols,source_data_nlevs,comm);
-  Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
-  grid->get_dofs_gids().sync_to_host();
-
-  // Check that padding matches source size:
-  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
-  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen(spa_data_file_name,"swband"),
-      "ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),
-      "ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
-
-  // Constuct views to read source data in from file
-  typename view_1d<Real>::HostMirror hyam_v_h("hyam",source_data_nlevs);
-  typename view_1d<Real>::HostMirror hybm_v_h("hybm",source_data_nlevs);
-  view_1d<Real> PS_v("PS",num_local_cols);
-  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
-
-  auto PS_v_h         = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h       = Kokkos::create_mirror_view(CCN3_v);      
-  auto AER_G_SW_v_h   = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h = Kokkos::create_mirror_view(AER_TAU_LW_v);
 
-  // Set up input structure to read data from file.
   using namespace ShortFieldTagsNames;
   FieldLayout scalar1d_layout { {LEV}, {source_data_nlevs} };
   FieldLayout scalar2d_layout_mid { {COL}, {num_local_cols} };
@@ -475,62 +484,111 @@ void SPAFunctions<S,D>
   std::map<std::string,view_1d_host<Real>> host_views;
   std::map<std::string,FieldLayout>  layouts;
   // Define each input variable we need
-  host_views["hyam"] = view_1d_host<Real>(hyam_v_h.data(),hyam_v_h.size());
+  host_views["hyam"] = r.hyam_h;
   layouts.emplace("hyam", scalar1d_layout);
-  host_views["hybm"] = view_1d_host<Real>(hybm_v_h.data(),hybm_v_h.size());
+  host_views["hybm"] = r.hybm_h;
   layouts.emplace("hybm", scalar1d_layout);
   //
-  host_views["PS"] = view_1d_host<Real>(PS_v_h.data(),PS_v_h.size());
+  host_views["PS"] = view_1d_host<Real>(r.PS_v_h.data(),r.PS_v_h.size());
   layouts.emplace("PS", scalar2d_layout_mid);
   //
-  host_views["CCN3"] = view_1d_host<Real>(CCN3_v_h.data(),CCN3_v_h.size());
+  host_views["CCN3"] = view_1d_host<Real>(r.CCN3_v_h.data(),r.CCN3_v_h.size());
   layouts.emplace("CCN3",scalar3d_layout_mid);
   //
-  host_views["AER_G_SW"] = view_1d_host<Real>(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
+  host_views["AER_G_SW"] = view_1d_host<Real>(r.AER_G_SW_v_h.data(),r.AER_G_SW_v_h.size());
   layouts.emplace("AER_G_SW",scalar3d_swband_layout);
   //
-  host_views["AER_SSA_SW"] = view_1d_host<Real>(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
+  host_views["AER_SSA_SW"] = view_1d_host<Real>(r.AER_SSA_SW_v_h.data(),r.AER_SSA_SW_v_h.size());
   layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_SW"] = view_1d_host<Real>(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
+  host_views["AER_TAU_SW"] = view_1d_host<Real>(r.AER_TAU_SW_v_h.data(),r.AER_TAU_SW_v_h.size());
   layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_LW"] = view_1d_host<Real>(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
+  host_views["AER_TAU_LW"] = view_1d_host<Real>(r.AER_TAU_LW_v_h.data(),r.AER_TAU_LW_v_h.size());
   layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
   //
-  
-  // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
-  AtmosphereInput spa_data_input(spa_data_in_params,grid,host_views,layouts);
-  spa_data_input.read_variables(time_index);
-  spa_data_input.finalize();
-  scorpio::eam_pio_closefile(spa_data_file_name);
+
+  // The input stream registers the file and sets the decomposition once. They are
+  // kept until the reader is destroyed (or re-inited).
+  spa_reader.input = std::make_shared<AtmosphereInput>(spa_data_in_params,grid,host_views,layouts);
+  stop_timer("EAMxx::SPA::init_spa_data_reader");
+} // END init_spa_data_reader
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::prefetch_spa_data(
+    const int                   time_index, // zero-based
+          SPADataReader&        spa_reader)
+{
+  EKAT_REQUIRE_MSG(spa_reader.input,
+      "Error! SPA data reader was not inited. Did you forget to call init_spa_data_reader?\n");
+
+  if (spa_reader.time_index_h==time_index) {
+    // Already there (or on its way)
+    return;
+  }
+
+  // The host views must not be in use by the caller until the read is over, which
+  // update_spa_data_from_file ensures by syncing the scorpio IO tasks.
+  auto input = spa_reader.input;
+  scorpio::enqueue_io_task([input,time_index]() {
+    input->read_variables(time_index);
+  });
+  spa_reader.time_index_h = time_index;
+}
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_data_from_file(
+    const int                   time_index, // zero-based
+          SPAHorizInterp&       spa_horiz_interp,
+          SPADataReader&        spa_reader,
+          SPAInput&             spa_data)
+{
+  start_timer("EAMxx::SPA::update_spa_data_from_file");
+
+  // Check that padding matches source size:
+  const int source_data_nlevs = spa_reader.nlevs;
+  const int nswbands = spa_reader.nswbands;
+  const int nlwbands = spa_reader.nlwbands;
+  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
+  EKAT_REQUIRE(spa_reader.CCN3_unpad.extent_int(0) == spa_data.data.ncols);
+
+  // Read the data, unless a prefetch already did (or is doing) it, in which case we
+  // only have to wait for it to be done.
+  start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+  prefetch_spa_data(time_index,spa_reader);
+  scorpio::sync_io_tasks();
   stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
   start_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
   // Copy data from host back to the device views.
-  Kokkos::deep_copy(PS_v,PS_v_h);
-  Kokkos::deep_copy(CCN3_v      , CCN3_v_h);      
-  Kokkos::deep_copy(AER_G_SW_v  , AER_G_SW_v_h);
-  Kokkos::deep_copy(AER_SSA_SW_v, AER_SSA_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_SW_v, AER_TAU_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_LW_v, AER_TAU_LW_v_h);
+  Kokkos::deep_copy(spa_reader.PS_v        , spa_reader.PS_v_h);
+  Kokkos::deep_copy(spa_reader.CCN3_v      , spa_reader.CCN3_v_h);
+  Kokkos::deep_copy(spa_reader.AER_G_SW_v  , spa_reader.AER_G_SW_v_h);
+  Kokkos::deep_copy(spa_reader.AER_SSA_SW_v, spa_reader.AER_SSA_SW_v_h);
+  Kokkos::deep_copy(spa_reader.AER_TAU_SW_v, spa_reader.AER_TAU_SW_v_h);
+  Kokkos::deep_copy(spa_reader.AER_TAU_LW_v, spa_reader.AER_TAU_LW_v_h);
 
   // Apply the remap to this data
-  spa_horiz_map.apply_remap(PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
-  // For padded data we need create temporary arrays to store the direct remapped data, then we can add
-  // padding.
+  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  spa_horiz_map.apply_remap(spa_reader.PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
+  // For padded data we use the reader's temporary arrays to store the direct remapped data,
+  // then we can add padding.
   int tgt_ncol = spa_data.data.ncols;
   int tgt_nlev = spa_data.data.nlevs-2;  // Note, the spa data already accounts for padding in the nlevs, so we subtract 2
-  view_2d<Real> CCN3_unpad("",tgt_ncol,tgt_nlev);
-  view_3d<Real> AER_G_SW_unpad("",tgt_ncol,nswbands,tgt_nlev);
-  view_3d<Real> AER_SSA_SW_unpad("",tgt_ncol,nswbands,tgt_nlev);
-  view_3d<Real> AER_TAU_SW_unpad("",tgt_ncol,nswbands,tgt_nlev);
-  view_3d<Real> AER_TAU_LW_unpad("",tgt_ncol,nlwbands,tgt_nlev);
+  const auto CCN3_unpad       = spa_reader.CCN3_unpad;
+  const auto AER_G_SW_unpad   = spa_reader.AER_G_SW_unpad;
+  const auto AER_SSA_SW_unpad = spa_reader.AER_SSA_SW_unpad;
+  const auto AER_TAU_SW_unpad = spa_reader.AER_TAU_SW_unpad;
+  const auto AER_TAU_LW_unpad = spa_reader.AER_TAU_LW_unpad;
   // Apply remap to "unpadded" data
-  spa_horiz_map.apply_remap(CCN3_v,CCN3_unpad);
-  spa_horiz_map.apply_remap(AER_G_SW_v, AER_G_SW_unpad);
-  spa_horiz_map.apply_remap(AER_SSA_SW_v, AER_SSA_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_SW_v, AER_TAU_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_LW_v, AER_TAU_LW_unpad);
+  spa_horiz_map.apply_remap(spa_reader.CCN3_v,CCN3_unpad);
+  spa_horiz_map.apply_remap(spa_reader.AER_G_SW_v, AER_G_SW_unpad);
+  spa_horiz_map.apply_remap(spa_reader.AER_SSA_SW_v, AER_SSA_SW_unpad);
+  spa_horiz_map.apply_remap(spa_reader.AER_TAU_SW_v, AER_TAU_SW_unpad);
+  spa_horiz_map.apply_remap(spa_reader.AER_TAU_LW_v, AER_TAU_LW_unpad);
   stop_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
   start_timer("EAMxx::SPA::update_spa_data_from_file::copy_and_pad");
   // Copy unpadded data to SPA data structure, add padding.
@@ -603,8 +661,8 @@ void SPAFunctions<S,D>
   for (int kk=0; kk<source_data_nlevs; kk++) {
     int pack = (kk+1) / Spack::n; 
     int kidx = (kk+1) % Spack::n;
-    hyam_h(pack)[kidx] = hyam_v_h(kk);
-    hybm_h(pack)[kidx] = hybm_v_h(kk);
+    hyam_h(pack)[kidx] = spa_reader.hyam_h(kk);
+    hybm_h(pack)[kidx] = spa_reader.hybm_h(kk);
   }
   const int pack = (source_data_nlevs+1) / Spack::n;
   const int kidx = (source_data_nlevs+1) % Spack::n;
@@ -616,15 +674,29 @@ void SPAFunctions<S,D>
 
 } // END update_spa_data_from_file
 
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_data_from_file(
+    const std::string&          spa_data_file_name,
+    const int                   time_index, // zero-based
+    const int                   nswbands,
+    const int                   nlwbands,
+          SPAHorizInterp&       spa_horiz_interp,
+          SPAInput&             spa_data)
+{
+  SPADataReader spa_reader;
+  init_spa_data_reader(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,spa_data.data.ncols,spa_reader);
+  update_spa_data_from_file(time_index,spa_horiz_interp,spa_reader,spa_data);
+} // END update_spa_data_from_file
+
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
 void SPAFunctions<S,D>
 ::update_spa_timestate(
-  const std::string&     spa_data_file_name,
-  const int              nswbands,
-  const int              nlwbands,
   const util::TimeStamp& ts,
         SPAHorizInterp&  spa_horiz_interp,
+        SPADataReader&   spa_reader,
         SPATimeState&    time_state, 
         SPAInput&        spa_beg,
         SPAInput&        spa_end)
@@ -635,20 +707,32 @@ void SPAFunctions<S,D>
   //        any other frequency.
   const auto month = ts.get_month();
   if (month != time_state.current_month or !time_state.inited) {
+    auto next = [](const int m) { return m==12 ? 1 : m+1; };
+    const bool new_month_is_next = time_state.inited and month==next(time_state.current_month);
 
     // Update the SPA time state information
     time_state.current_month = month;
     time_state.t_beg_month = util::TimeStamp({ts.get_year(),month,1}, {0,0,0}).frac_of_year_in_days();
     time_state.days_this_month = util::days_in_month(ts.get_year(),month);
     // Update the SPA forcing data for this month and next month
-    // Start by copying next months data to this months data structure.  
     // NOTE: If the timestep is bigger than monthly this could cause the wrong values
     //       to be assigned.  A timestep greater than a month is very unlikely so we
     //       will proceed.
     // NOTE: we use zero-based time indexing here.
-    update_spa_data_from_file(spa_data_file_name,time_state.current_month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
-    int next_month = time_state.current_month==12 ? 1 : time_state.current_month+1;
-    update_spa_data_from_file(spa_data_file_name,next_month-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    const int next_month = next(time_state.current_month);
+    if (new_month_is_next) {
+      // This month's data is last month's end data, so swap the structures
+      // rather than reading it again.
+      std::swap(spa_beg,spa_end);
+    } else {
+      update_spa_data_from_file(time_state.current_month-1,spa_horiz_interp,spa_reader,spa_beg);
+    }
+    update_spa_data_from_file(next_month-1,spa_horiz_interp,spa_reader,spa_end);
+
+    // Start reading the data needed at the next month change, so that (if the
+    // scorpio IO thread is running) it is ready by then.
+    prefetch_spa_data(next(next_month)-1,spa_reader);
+
     // If time state was not initialized it is now:
     time_state.inited = true;
   }
@@ -84,34 +84,55 @@ TEST_CASE("spa_read_data","spa")
   auto aer_tau_lw_h = Kokkos::create_mirror_view(spa_data.data.AER_TAU_LW);
   auto dofs_gids_h = Kokkos::create_mirror_view(dofs_gids);
   Kokkos::deep_copy(dofs_gids_h,dofs_gids);
-  for (int time_index = 0;time_index<max_time; time_index++) {
-    SPAFunc::update_spa_data_from_file(spa_data_file, time_index, nswbands, nlwbands,
-                                       spa_horiz_interp, spa_data);
-    Kokkos::deep_copy(ps_h,spa_data.PS);
-    Kokkos::deep_copy(ccn3_h,spa_data.data.CCN3);
-    Kokkos::deep_copy(aer_g_sw_h,spa_data.data.AER_G_SW);
-    Kokkos::deep_copy(aer_ssa_sw_h,spa_data.data.AER_SSA_SW);
-    Kokkos::deep_copy(aer_tau_sw_h,spa_data.data.AER_TAU_SW);
-    Kokkos::deep_copy(aer_tau_lw_h,spa_data.data.AER_TAU_LW);
-    for (size_t dof_i=0;dof_i<dofs_gids_h.size();dof_i++) {
-      REQUIRE(std::abs(ps_h(dof_i) - ps_func(time_index,ncols_src))<tol);
-      for (int kk=0;kk<nlevs;kk++) {
-        // Recall, SPA data read from file is padded, so we need to offset the kk index for the data by 1.
-        int kpack = (kk+1) / Spack::n;
-        int kidx  = (kk+1) % Spack::n;
-        REQUIRE(std::abs(ccn3_h(dof_i,kpack)[kidx] - ccn3_func(time_index, kk, ncols_src))<tol);
-        for (int n=0;n<nswbands;n++) {
-          REQUIRE(aer_g_sw_h(dof_i,n,kpack)[kidx]   == aer_func(time_index,n,kk,ncols_src,0));
-          REQUIRE(aer_ssa_sw_h(dof_i,n,kpack)[kidx] == aer_func(time_index,n,kk,ncols_src,1));
-          REQUIRE(aer_tau_sw_h(dof_i,n,kpack)[kidx] == aer_func(time_index,n,kk,ncols_src,2));
-        }
-        for (int n=0;n<nlwbands;n++) {
-          REQUIRE(aer_tau_lw_h(dof_i,n,kpack)[kidx] ==  aer_func(time_index,n,kk,ncols_src,3));
+  // The second pass keeps the file open in a persistent reader, and reads each time
+  // slice ahead of time. In the async exec, MPI is inited with MPI_THREAD_MULTIPLE,
+  // and the reads are done in the background by the scorpio IO thread.
+#ifdef SCREAM_SPA_ASYNC_PREFETCH
+  REQUIRE (scorpio::start_io_thread());
+#endif
+  SPAFunc::SPADataReader spa_reader;
+  for (int pass=0; pass<2; ++pass) {
+    if (pass==1) {
+      SPAFunc::init_spa_data_reader(spa_data_file, nswbands, nlwbands, spa_horiz_interp,
+                                    dofs_gids.size(), spa_reader);
+      SPAFunc::prefetch_spa_data(0, spa_reader);
+    }
+    for (int time_index = 0;time_index<max_time; time_index++) {
+      if (pass==0) {
+        SPAFunc::update_spa_data_from_file(spa_data_file, time_index, nswbands, nlwbands,
+                                           spa_horiz_interp, spa_data);
+      } else {
+        SPAFunc::update_spa_data_from_file(time_index, spa_horiz_interp, spa_reader, spa_data);
+        SPAFunc::prefetch_spa_data((time_index+1) % max_time, spa_reader);
+      }
+      Kokkos::deep_copy(ps_h,spa_data.PS);
+      Kokkos::deep_copy(ccn3_h,spa_data.data.CCN3);
+      Kokkos::deep_copy(aer_g_sw_h,spa_data.data.AER_G_SW);
+      Kokkos::deep_copy(aer_ssa_sw_h,spa_data.data.AER_SSA_SW);
+      Kokkos::deep_copy(aer_tau_sw_h,spa_data.data.AER_TAU_SW);
+      Kokkos::deep_copy(aer_tau_lw_h,spa_data.data.AER_TAU_LW);
+      for (size_t dof_i=0;dof_i<dofs_gids_h.size();dof_i++) {
+        REQUIRE(std::abs(ps_h(dof_i) - ps_func(time_index,ncols_src))<tol);
+        for (int kk=0;kk<nlevs;kk++) {
+          // Recall, SPA data read from file is padded, so we need to offset the kk index for the data by 1.
+          int kpack = (kk+1) / Spack::n;
+          int kidx  = (kk+1) % Spack::n;
+          REQUIRE(std::abs(ccn3_h(dof_i,kpack)[kidx] - ccn3_func(time_index, kk, ncols_src))<tol);
+          for (int n=0;n<nswbands;n++) {
+            REQUIRE(aer_g_sw_h(dof_i,n,kpack)[kidx]   == aer_func(time_index,n,kk,ncols_src,0));
+            REQUIRE(aer_ssa_sw_h(dof_i,n,kpack)[kidx] == aer_func(time_index,n,kk,ncols_src,1));
+            REQUIRE(aer_tau_sw_h(dof_i,n,kpack)[kidx] == aer_func(time_index,n,kk,ncols_src,2));
+          }
+          for (int n=0;n<nlwbands;n++) {
+            REQUIRE(aer_tau_lw_h(dof_i,n,kpack)[kidx] ==  aer_func(time_index,n,kk,ncols_src,3));
+          }
         }
       }
     }
   }
-  
+  scorpio::sync_io_tasks();
+  spa_reader.input = nullptr;
+
   // All Done 
   scorpio::eam_pio_finalize();
 } // run_property
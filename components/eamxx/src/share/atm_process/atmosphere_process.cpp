@@ -5,6 +5,7 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <map>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -354,8 +355,49 @@ void AtmosphereProcess::set_computed_group (const FieldGroup& group) {
 void AtmosphereProcess::run_property_check (const prop_check_ptr&       property_check,
                                             const CheckFailHandling     check_fail_handling,
                                             const PropertyCheckCategory property_check_category) const {
-  auto res_and_msg = property_check->check();
+  handle_property_check_result(property_check,property_check->check(),
+                               check_fail_handling,property_check_category);
+}
+
+void AtmosphereProcess::
+run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                     const PropertyCheckCategory property_check_category) const
+{
+  // Stats are computed the first time a stats-based check on a field is found,
+  // and reused for all other stats-based checks on the same field.
+  std::map<const FieldHeader*,FieldCheckStats> stats_cache;
+  for (const auto& it : checks) {
+    const auto& pc = it.second;
+    PropertyCheck::ResultAndMsg res_and_msg;
+    if (pc->uses_field_stats()) {
+      const auto& f = pc->fields().front();
+      const auto key = f.get_header_ptr().get();
+      auto stats_it = stats_cache.find(key);
+      if (stats_it==stats_cache.end()) {
+        stats_it = stats_cache.emplace(key,compute_field_check_stats(f)).first;
+      }
+      res_and_msg = pc->check_from_stats(stats_it->second);
+    } else {
+      res_and_msg = pc->check();
+    }
+
+    handle_property_check_result(pc,res_and_msg,it.first,property_check_category);
+
+    if (res_and_msg.result==CheckResult::Repairable) {
+      // The check repaired some fields, so their stats are no longer valid
+      for (const auto f : pc->repairable_fields()) {
+        stats_cache.erase(f->get_header_ptr().get());
+      }
+    }
+  }
+}
 
+void AtmosphereProcess::
+handle_property_check_result (const prop_check_ptr&               property_check,
+                              const PropertyCheck::ResultAndMsg&  res_and_msg,
+                              const CheckFailHandling             check_fail_handling,
+                              const PropertyCheckCategory         property_check_category) const
+{
   // string for output
   std::string pre_post_str;
   if (property_check_category == PropertyCheckCategory::Precondition)  pre_post_str = "pre-condition";
@@ -446,18 +488,12 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
 
 void AtmosphereProcess::run_precondition_checks () const {
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
+  run_property_checks(m_precondition_checks,PropertyCheckCategory::Precondition);
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
+  run_property_checks(m_postcondition_checks,PropertyCheckCategory::Postcondition);
 }
 
 void AtmosphereProcess::run_column_conservation_check () const {
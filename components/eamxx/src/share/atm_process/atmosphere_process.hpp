@@ -482,6 +482,18 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Run a list of property checks. Checks that only need summary stats of a field
+  // (see PropertyCheck::uses_field_stats) share them, so that each field is read
+  // only once, regardless of how many such checks are set on it.
+  void run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                            const PropertyCheckCategory property_check_category) const;
+
+  // Act on the result of a property check (repair, warn, or error out)
+  void handle_property_check_result (const prop_check_ptr&               property_check,
+                                     const PropertyCheck::ResultAndMsg&  res_and_msg,
+                                     const CheckFailHandling             check_fail_handling,
+                                     const PropertyCheckCategory         property_check_category) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
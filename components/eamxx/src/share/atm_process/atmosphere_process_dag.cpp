@@ -341,15 +341,27 @@ void AtmProcDAG::cleanup () {
   m_fid_to_last_provider.clear();
   m_unmet_deps.clear();
   m_has_unmet_deps = false;
+  m_parallel_conflicts.clear();
 }
 
 void AtmProcDAG::
-add_nodes (const group_type& atm_procs)
+add_nodes (const group_type& atm_procs, const int concurrent_begin)
 {
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, all procs in the group read the state at the beginning
+  // of the group, so none of them can provide inputs to the others.
+  // NOTE: if a sequential group is nested inside a parallel one, we treat its
+  //       nodes as concurrent too. This only affects the edges that are drawn,
+  //       since the dependencies inside the nested group are still met.
+  int group_begin = concurrent_begin;
+  if (not sequential) {
+    check_parallel_independence(atm_procs);
+    if (group_begin<0) {
+      group_begin = m_nodes.size();
+    }
+  }
 
   for (int i=0; i<num_procs; ++i) {
     const auto proc = atm_procs.get_process(i);
@@ -361,7 +373,7 @@ add_nodes (const group_type& atm_procs)
       // Add all the stuff in the group.
       // Note: no need to add remappers for this process, because
       //       the sub-group will have its remappers taken care of
-      add_nodes(*group);
+      add_nodes(*group,group_begin);
     } else {
       // Create a node for the process
       // Node& node = m_nodes[proc->name()];
@@ -369,6 +381,7 @@ add_nodes (const group_type& atm_procs)
       m_nodes.push_back(Node());
       Node& node = m_nodes.back();;
       node.id = id;
+      node.concurrent_begin = group_begin>=0 ? group_begin : id;
       node.name = proc->name();
       m_unmet_deps[id].clear(); // Ensures an entry for this id is in the map
 
@@ -437,15 +450,111 @@ add_nodes (const group_type& atm_procs)
   }
 }
 
+void AtmProcDAG::check_parallel_independence (const group_type& atm_procs)
+{
+  // Gather the ids of all fields required/computed by each process.
+  const int num_procs = atm_procs.get_num_processes();
+  std::vector<std::set<FieldIdentifier>> in(num_procs), out(num_procs);
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    in[i]  = gather_fids(proc->get_fields_in(), proc->get_groups_in());
+    out[i] = gather_fids(proc->get_fields_out(),proc->get_groups_out());
+  }
+
+  // Processes are independent if
+  //  - no process requires a field that another process produces (i.e., computes
+  //    without requiring it), since it would read a stale value;
+  //  - fields computed by more than one process are updated by all of them, so
+  //    that the sum of their increments is well defined.
+  // A field updated by one process can be read by the other ones, since the
+  // group hands them the field value at the beginning of the group step.
+  for (int i=0; i<num_procs; ++i) {
+    for (const auto& fid : out[i]) {
+      const bool updated_by_i = ekat::contains(in[i],fid);
+      for (int j=0; j<num_procs; ++j) {
+        if (j==i) {
+          continue;
+        }
+        const bool required_by_j = ekat::contains(in[j],fid);
+        const bool computed_by_j = ekat::contains(out[j],fid);
+        if ( (required_by_j and not updated_by_i) or
+             (computed_by_j and not (updated_by_i and required_by_j)) ) {
+          const auto name_j = atm_procs.get_process(j)->name();
+          m_parallel_conflicts[name_j].insert(fid.name() + " [" + fid.get_grid_name() + "]");
+        }
+      }
+    }
+  }
+}
+
+std::vector<std::set<int>> AtmProcDAG::
+get_task_dependencies (const group_type& atm_procs)
+{
+  EKAT_REQUIRE_MSG (atm_procs.get_schedule_type()==ScheduleType::Sequential,
+      "Error! Task dependencies are only defined for sequential groups.\n"
+      "  - group name: " + atm_procs.name() + "\n");
+
+  const int num_procs = atm_procs.get_num_processes();
+  std::vector<std::set<FieldIdentifier>> in(num_procs), out(num_procs);
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    in[i]  = gather_fids(proc->get_fields_in(), proc->get_groups_in());
+    out[i] = gather_fids(proc->get_fields_out(),proc->get_groups_out());
+  }
+
+  // Handy lambda to check if two sets intersect
+  auto intersect = [](const std::set<FieldIdentifier>& a,
+                      const std::set<FieldIdentifier>& b) -> bool {
+    for (const auto& fid : a) {
+      if (b.count(fid)==1) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  std::vector<std::set<int>> deps(num_procs);
+  for (int j=0; j<num_procs; ++j) {
+    for (int i=0; i<j; ++i) {
+      if (intersect(out[i],in[j]) or intersect(in[i],out[j]) or intersect(out[i],out[j])) {
+        deps[j].insert(i);
+      }
+    }
+  }
+  return deps;
+}
+
+std::set<FieldIdentifier> AtmProcDAG::
+gather_fids (const std::list<Field>& fields,
+             const std::list<FieldGroup>& groups)
+{
+  std::set<FieldIdentifier> fids;
+  for (const auto& f : fields) {
+    fids.insert(f.get_header().get_identifier());
+  }
+  for (const auto& g : groups) {
+    if (g.m_bundle) {
+      fids.insert(g.m_bundle->get_header().get_identifier());
+    }
+    for (const auto& it : g.m_fields) {
+      fids.insert(it.second->get_header().get_identifier());
+    }
+  }
+  return fids;
+}
+
 void AtmProcDAG::add_edges () {
   for (auto& node : m_nodes) {
+    // Nodes in a parallel-split group can only be fed by nodes before the group
+    const int first_concurrent = node.concurrent_begin>=0 ? node.concurrent_begin : node.id;
+
     // First individual input fields. Add this node as a children
     // of any *previous* node that computes them. If none provides
     // them, add to the unmet deps list
     for (auto id : node.required) {
       auto it = m_fid_to_last_provider.find(id);
-      // Note: check that last provider id is SMALLER than this node id
-      if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+      // Note: check that last provider id is SMALLER than the first concurrent node id
+      if (it!=m_fid_to_last_provider.end() and it->second<first_concurrent) {
         auto parent_id = it->second;
         m_nodes[parent_id].children.push_back(node.id);
       } else {
@@ -467,8 +576,8 @@ void AtmProcDAG::add_edges () {
 
       // First check when the group as a whole was last updated
       auto it = m_fid_to_last_provider.find(id);
-      // Note: check that last provider id is SMALLER than this node id
-      if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+      // Note: check that last provider id is SMALLER than the first concurrent node id
+      if (it!=m_fid_to_last_provider.end() and it->second<first_concurrent) {
         last_group_update_id = it->second;
       }
       // Then check when each group member was last updated
@@ -477,8 +586,8 @@ void AtmProcDAG::add_edges () {
         const auto& fid = f_it.second->get_header().get_identifier();
         auto fid_id = std::find(m_fids.begin(),m_fids.end(),fid) - m_fids.begin();
         it = m_fid_to_last_provider.find(fid_id);
-        // Note: check that last provider id is SMALLER than this node id
-        if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+        // Note: check that last provider id is SMALLER than the first concurrent node id
+        if (it!=m_fid_to_last_provider.end() and it->second<first_concurrent) {
           last_members_update_id[i] = it->second;
         }
         ++i;
@@ -26,11 +26,38 @@ public:
     return m_unmet_deps;
   }
 
+  // In parallel-split groups, all processes see the same input state, and the
+  // group output is the input state plus the sum of the increments of each process.
+  // This is only meaningful if the processes in the group are independent. These
+  // methods expose which fields (if any) break this assumption, for each process.
+  bool has_parallel_conflicts () const { return m_parallel_conflicts.size()>0; }
+  const std::map<std::string,std::set<std::string>>& parallel_conflicts () const {
+    return m_parallel_conflicts;
+  }
+
+  // Build the dependencies between the procs of a (sequential) group, without
+  // recursing in sub-groups. Proc j depends on proc i<j if j reads a field that
+  // i writes, if j writes a field that i reads, or if both write the same field.
+  // Upon return, deps[j] contains all the procs that must complete before proc j
+  // can start. Running procs in any order compatible with deps gives the same
+  // result as running them in the order they appear in the group.
+  static std::vector<std::set<int>> get_task_dependencies (const group_type& atm_procs);
+
 protected:
 
+  // Gather the fids of all fields in the input list, as well as of all
+  // the fields in the groups (and the bundled field, if any).
+  static std::set<FieldIdentifier> gather_fids (const std::list<Field>& fields,
+                                                const std::list<FieldGroup>& groups);
+
   void cleanup ();
 
-  void add_nodes (const group_type& atm_procs);
+  // If concurrent_begin>=0, all nodes created belong to a parallel-split group,
+  // whose first node has id concurrent_begin.
+  void add_nodes (const group_type& atm_procs, const int concurrent_begin = -1);
+
+  // Check that processes in a parallel-split group are independent
+  void check_parallel_independence (const group_type& atm_procs);
 
   void add_edges ();
 
@@ -48,6 +75,10 @@ protected:
     std::vector<int>  children;
     std::string       name;
     int               id;
+    // Id of the first node in the parallel-split group this node belongs to
+    // (equal to id for sequential scheduling). Only nodes with an id smaller
+    // than this can provide inputs to this node.
+    int               concurrent_begin = -1;
     std::set<int>     computed;     // output fields
     std::set<int>     required;     // input  fields
     std::set<int>     gr_computed;  // output groups
@@ -67,6 +98,10 @@ protected:
   std::map<int,std::set<int>>     m_unmet_deps;
   bool                            m_has_unmet_deps;
 
+  // Map a process name to the fields that prevent it from running in parallel
+  // with the other processes in its group
+  std::map<std::string,std::set<std::string>>  m_parallel_conflicts;
+
   // The nodes in the atm DAG
   std::vector<Node>               m_nodes;
 };
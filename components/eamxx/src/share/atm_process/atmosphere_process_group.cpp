@@ -1,5 +1,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
+#include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "share/property_checks/field_nan_check.hpp"
 
@@ -7,6 +9,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <memory>
+#include <algorithm>
 
 namespace scream {
 
@@ -27,7 +30,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -36,6 +38,13 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
     m_group_schedule_type = ScheduleType::Sequential;
   }
 
+  // In sequential scheduling, procs can be run by dependency level.
+  m_dependency_order = m_params.get<bool>("dependency_order",false);
+  if (m_dependency_order) {
+    EKAT_REQUIRE_MSG (m_group_schedule_type==ScheduleType::Sequential,
+        "Error! Option 'dependency_order' is only supported for sequential schedule.\n");
+  }
+
   // Create the individual atmosphere processes
   m_group_name = params.name();
 
@@ -49,25 +58,12 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (int i=0; i<m_group_size; ++i) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as the
+    // comm of this APG. In parallel scheduling, all procs run on all ranks,
+    // and the group takes care of combining their increments (see run_parallel).
+    // NOTE: a future extension could assign a sub-comm to each atm proc, and
+    //       remap input/output fields to/from the sub-comm distribution.
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      ekat::error::runtime_abort("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Check if the i-th entry is a "named" atm proc or a group defined on the fly.
     // In the first case, the i-th entry of the string list is just a string,
@@ -365,6 +361,12 @@ void AtmosphereProcessGroup::add_postcondition_nan_checks () const {
 }
 
 void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    setup_parallel_split ();
+  } else if (m_dependency_order) {
+    setup_dependency_levels ();
+  }
+
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(timestamp(),run_type);
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -377,10 +379,12 @@ void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
 }
 
 void AtmosphereProcessGroup::run_impl (const double dt) {
-  if (m_group_schedule_type==ScheduleType::Sequential) {
-    run_sequential(dt);
-  } else {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
     run_parallel(dt);
+  } else if (m_dependency_order) {
+    run_dependency_order(dt);
+  } else {
+    run_sequential(dt);
   }
 }
 
@@ -407,8 +411,242 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // Same logic as in run_sequential for the time stamps update
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+
+  // Save the input state of the fields computed by more than one proc, or
+  // computed by one proc and read by another.
+  // NOTE: the DAG check in setup_parallel_split guarantees that every other
+  //       computed field is not used by any other proc, so we can let its
+  //       provider update it in place.
+  const std::string copy_timer = m_timer_prefix + name() + "::parallel_split_copies";
+  start_timer (copy_timer);
+  for (auto& psf : m_ps_fields) {
+    psf.start.deep_copy(psf.state);
+    psf.num_done = 0;
+  }
+  stop_timer (copy_timer);
+
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
+    atm_proc->set_update_time_stamps(do_update);
+    // Run the process
+    atm_proc->run(dt);
+
+    // Accumulate the increment of this proc. If other procs still have to
+    // read or update the field, restore the input state for them, otherwise
+    // add the increments of the previous providers to the state.
+    start_timer (copy_timer);
+    for (int idx : m_ps_proc_fields[iproc]) {
+      auto& psf = m_ps_fields[idx];
+      if (psf.last_proc==iproc) {
+        if (psf.num_done>0) {
+          // state = start + inc + (accum - start)
+          psf.state.update(psf.accum,Real(1),Real(1));
+          psf.state.update(psf.start,Real(-1),Real(1));
+        }
+      } else {
+        if (psf.num_done==0) {
+          psf.accum.deep_copy(psf.state);
+        } else {
+          psf.accum.update(psf.state,Real(1),Real(1));
+          psf.accum.update(psf.start,Real(-1),Real(1));
+        }
+        psf.state.deep_copy(psf.start);
+      }
+      ++psf.num_done;
+    }
+    // If this proc is the last one reading a field, all its providers ran
+    // already, and their combined result is in accum.
+    for (int idx : m_ps_proc_last_reads[iproc]) {
+      auto& psf = m_ps_fields[idx];
+      psf.state.deep_copy(psf.accum);
+    }
+    stop_timer (copy_timer);
+#ifdef SCREAM_HAS_MEMORY_USAGE
+    long long my_mem_usage = get_mem_usage(MB);
+    long long max_mem_usage;
+    m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+    m_atm_logger->debug("[EAMxx::run_parallel::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+#endif
+  }
+}
+
+void AtmosphereProcessGroup::run_dependency_order (const double dt) {
+  // Same logic as in run_sequential for the time stamps update
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+
+  // All the procs a proc depends on are in previous levels, so running the
+  // levels in order gives the same result as running the procs in the listed order.
+  // NOTE: this only changes the order of the procs, which are still run one
+  //       after the other on this thread.
+  //       AtmosphereProcess::run starts/stops timers, writes to the logger, and
+  //       issues MPI collectives (hashes, property checks), none of which can be
+  //       done from multiple host threads, and all of which must happen in the
+  //       same order on all ranks.
+  for (const auto& procs : m_dependency_levels) {
+    for (int iproc : procs) {
+      auto atm_proc = m_atm_processes[iproc];
+      atm_proc->set_update_time_stamps(do_update);
+      atm_proc->run(dt);
+#ifdef SCREAM_HAS_MEMORY_USAGE
+      long long my_mem_usage = get_mem_usage(MB);
+      long long max_mem_usage;
+      m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+      m_atm_logger->debug("[EAMxx::run_dependency_order::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+#endif
+    }
+  }
+}
+
+void AtmosphereProcessGroup::setup_dependency_levels ()
+{
+  // Assign each proc to a level, one past the max level of the procs it depends on.
+  // Procs in the same level do not depend on each other.
+  const auto deps = AtmProcDAG::get_task_dependencies(*this);
+  std::vector<int> level(m_group_size,0);
+  int num_levels = 0;
+  for (int j=0; j<m_group_size; ++j) {
+    for (int i : deps[j]) {
+      level[j] = std::max(level[j],level[i]+1);
+    }
+    num_levels = std::max(num_levels,level[j]+1);
+  }
+
+  m_dependency_levels.clear();
+  m_dependency_levels.resize(num_levels);
+  for (int j=0; j<m_group_size; ++j) {
+    m_dependency_levels[level[j]].push_back(j);
+  }
+}
+
+void AtmosphereProcessGroup::setup_parallel_split ()
+{
+  // Check that the procs are indeed independent, using the DAG of this group
+  AtmProcDAG dag;
+  dag.create_dag(*this);
+  if (dag.has_parallel_conflicts()) {
+    std::string msg;
+    for (const auto& it : dag.parallel_conflicts()) {
+      msg += "   - " + it.first + ": " + ekat::join(it.second,", ") + "\n";
+    }
+    EKAT_ERROR_MSG (
+        "Error! The atm procs in a parallel-split group are not independent.\n"
+        "   atm proc group: " + name() + "\n"
+        " Conflicting fields for each atm proc:\n" + msg);
+  }
+
+  // Gather all the fields computed by each proc. For groups, we work with
+  // the individual fields, since a bundled field may also be computed
+  // field-by-field by another proc.
+  auto gather = [](const AtmosphereProcess& ap) -> std::list<Field> {
+    std::list<Field> fields = ap.get_fields_out();
+    for (const auto& g : ap.get_groups_out()) {
+      for (const auto& it : g.m_fields) {
+        fields.push_back(*it.second);
+      }
+    }
+    return fields;
+  };
+  // Same as above, for the fields read by each proc
+  auto gather_in = [](const AtmosphereProcess& ap) -> std::list<FieldIdentifier> {
+    std::list<FieldIdentifier> fids;
+    for (const auto& f : ap.get_fields_in()) {
+      fids.push_back(f.get_header().get_identifier());
+    }
+    for (const auto& g : ap.get_groups_in()) {
+      for (const auto& it : g.m_fields) {
+        fids.push_back(it.second->get_header().get_identifier());
+      }
+    }
+    return fids;
+  };
+
+  std::vector<ParallelSplitField> ps_fields;
+  std::vector<std::vector<int>> ps_proc_fields(m_group_size);
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    for (const auto& f : gather(*m_atm_processes[iproc])) {
+      const auto& fid = f.get_header().get_identifier();
+      auto it = std::find_if(ps_fields.begin(),ps_fields.end(),
+          [&](const ParallelSplitField& psf) {
+            return psf.state.get_header().get_identifier()==fid;
+          });
+      int idx = std::distance(ps_fields.begin(),it);
+      if (it==ps_fields.end()) {
+        ParallelSplitField psf;
+        psf.state = f;
+        psf.num_providers = 0;
+        psf.num_done = 0;
+        psf.last_proc = iproc;
+        ps_fields.push_back(psf);
+      }
+      auto& psf = ps_fields[idx];
+      if (ekat::contains(ps_proc_fields[iproc],idx)) {
+        continue;
+      }
+      ++psf.num_providers;
+      psf.last_proc = iproc;
+      ps_proc_fields[iproc].push_back(idx);
+
+      EKAT_REQUIRE_MSG (psf.num_providers==1 || fid.data_type()==DataType::RealType,
+          "Error! Parallel splitting can only combine increments of real-valued fields.\n"
+          "   atm proc group: " + name() + "\n"
+          "   field name    : " + fid.name() + "\n");
+    }
+  }
+
+  // Find the procs that read a computed field without computing it. The DAG
+  // check ensures that such a field is updated by its providers.
+  std::vector<std::vector<int>> ps_proc_reads(m_group_size);
+  std::vector<bool> read_by_others(ps_fields.size(),false);
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    for (const auto& fid : gather_in(*m_atm_processes[iproc])) {
+      for (size_t idx=0; idx<ps_fields.size(); ++idx) {
+        auto& psf = ps_fields[idx];
+        if (psf.state.get_header().get_identifier()!=fid or
+            ekat::contains(ps_proc_fields[iproc],static_cast<int>(idx)) or
+            ekat::contains(ps_proc_reads[iproc],static_cast<int>(idx))) {
+          continue;
+        }
+        read_by_others[idx] = true;
+        psf.last_proc = std::max(psf.last_proc,iproc);
+        ps_proc_reads[iproc].push_back(idx);
+      }
+    }
+  }
+
+  // Only fields computed by more than one proc, or read by a proc other than
+  // their provider, need to be saved and combined
+  std::vector<int> new_idx(ps_fields.size(),-1);
+  m_ps_fields.clear();
+  for (size_t idx=0; idx<ps_fields.size(); ++idx) {
+    auto& psf = ps_fields[idx];
+    if (psf.num_providers>1 or read_by_others[idx]) {
+      psf.start = psf.state.clone();
+      psf.accum = psf.state.clone();
+      new_idx[idx] = m_ps_fields.size();
+      m_ps_fields.push_back(psf);
+    }
+  }
+  m_ps_proc_fields.clear();
+  m_ps_proc_fields.resize(m_group_size);
+  m_ps_proc_last_reads.clear();
+  m_ps_proc_last_reads.resize(m_group_size);
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    for (int idx : ps_proc_fields[iproc]) {
+      if (new_idx[idx]>=0) {
+        m_ps_proc_fields[iproc].push_back(new_idx[idx]);
+      }
+    }
+    for (int idx : ps_proc_reads[iproc]) {
+      if (ps_fields[idx].last_proc==iproc) {
+        m_ps_proc_last_reads[iproc].push_back(new_idx[idx]);
+      }
+    }
+  }
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -429,6 +667,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -497,6 +736,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -24,6 +24,24 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all the atm procs in the group see the same input
+ *  state, namely the state at the beginning of the group step. The output of
+ *  the group is the input state plus the sum of the increments computed by
+ *  each atm proc. The procs in the group must be independent (see AtmProcDAG).
+ *  A field updated by one proc can be read by other procs, which see its value
+ *  at the beginning of the group step.
+ *  Note: the procs are still executed one after the other, since they share
+ *  the memory handed out by the ATMBufferManager, and launch their kernels on
+ *  the default execution space.
+ *
+ *  In sequential scheduling, if dependency_order is true, the group uses the
+ *  dependencies between its procs (see AtmProcDAG::get_task_dependencies) to
+ *  assign each proc to a dependency level, and runs the procs level by level.
+ *  The result is the same as running the procs in the order they are listed.
+ *  Note: this is only a reordering. The procs of a level are still run one
+ *  after the other on the calling thread, since AtmosphereProcess::run uses
+ *  timers, the logger, and MPI collectives, which must stay on the main thread.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -113,6 +131,7 @@ protected:
 
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
+  void run_dependency_order (const double dt);
 
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
@@ -132,6 +151,38 @@ protected:
 
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
+
+  // Parallel splitting only: for each field computed by more than one proc in
+  // the group, or computed by one proc and read by another, store the input
+  // state and the accumulated increments of the procs.
+  void setup_parallel_split ();
+
+  struct ParallelSplitField {
+    Field state;          // The field the atm procs read/write
+    Field start;          // The value of the field at the beginning of the group step
+    Field accum;          // The start value plus the increments of the providers that ran so far
+    int   num_providers;  // How many procs in the group compute this field
+    int   num_done;       // How many providers already ran in the current step
+    int   last_proc;      // The last proc in the group that computes or reads this field
+  };
+  std::vector<ParallelSplitField>   m_ps_fields;
+
+  // For each proc in the group, the entries of m_ps_fields that it computes
+  std::vector<std::vector<int>>     m_ps_proc_fields;
+
+  // For each proc in the group, the entries of m_ps_fields that it only reads,
+  // and for which it is the last proc in the group to use them
+  std::vector<std::vector<int>>     m_ps_proc_last_reads;
+
+  // Sequential scheduling only: whether to run the procs by dependency level,
+  // rather than in the order they are listed.
+  bool                              m_dependency_order;
+
+  // Group the procs by dependency level, such that all the procs a proc
+  // depends on are in previous levels.
+  void setup_dependency_levels ();
+
+  std::vector<std::vector<int>>     m_dependency_levels;
 };
 
 } // namespace scream
@@ -209,11 +209,12 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
+  for (size_t i=0; i<m_fields_names.size(); ++i) {
+    const auto& name = m_fields_names[i];
 
     // Read the data
     auto v1d = m_host_views_1d.at(name);
-    scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
+    scorpio::grid_read_data_array(m_var_handles[i],time_index,v1d.data(),v1d.size());
 
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
@@ -330,6 +331,7 @@ void AtmosphereInput::finalize()
 
   m_host_views_1d.clear();
   m_layouts.clear();
+  m_var_handles.clear();
 
   m_inited_with_views = false;
   m_inited_with_fields = false;
@@ -357,6 +359,7 @@ void AtmosphereInput::register_variables()
 
   // Cycle through all fields
   const auto& fp_precision = "real";
+  m_var_handles.clear();
   for (auto const& name : m_fields_names) {
     // Determine the IO-decomp and construct a vector of dimension ids for this variable:
     const auto& layout = m_layouts.at(name);
@@ -378,8 +381,8 @@ void AtmosphereInput::register_variables()
     //  Currently the field_manager only stores Real variables so it is not an issue,
     //  but in the future if non-Real variables are added we will want to accomodate that.
     //TODO: Should be able to simply inquire from the netCDF the dimensions for each variable.
-    scorpio::register_variable(m_filename, name, name,
-                               vec_of_dims, fp_precision, io_decomp_tag);
+    m_var_handles.push_back(scorpio::register_variable(m_filename, name, name,
+                                                       vec_of_dims, fp_precision, io_decomp_tag));
   }
 }
 
@@ -135,6 +135,9 @@ protected:
   std::string               m_filename;
   std::vector<std::string>  m_fields_names;
 
+  // Handles of the variables in the file, ordered as m_fields_names
+  std::vector<scorpio::VarHandle>  m_var_handles;
+
   bool m_inited_with_fields        = false;
   bool m_inited_with_views         = false;
 }; // Class AtmosphereInput
@@ -12,6 +12,7 @@
 
 #include <numeric>
 #include <fstream>
+#include <cstring>
 
 namespace scream
 {
@@ -40,6 +41,19 @@ void combine (const Real& new_val, Real& curr_val, const OutputAvgType avg_type)
   }
 }
 
+// Same as above, but new values equal to the fill value are skipped, and counted
+// in num_masked, so that the output can be computed from the valid samples only.
+KOKKOS_INLINE_FUNCTION
+void combine_and_mask (const Real& new_val, Real& curr_val, int& num_masked,
+                       const OutputAvgType avg_type, const Real fill_value)
+{
+  if (new_val==fill_value) {
+    ++num_masked;
+  } else {
+    combine(new_val,curr_val,avg_type);
+  }
+}
+
 // This helper function is used to make sure that the list of fields in
 // m_fields_names is a list of unique strings, otherwise throw an error.
 void sort_and_check(std::vector<std::string>& fields)
@@ -93,6 +107,10 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     m_fill_value = static_cast<float>(params.get<double>("Fill Value"));
   }
 
+  if (params.isSublist("output_control")) {
+    m_async_write = params.sublist("output_control").get("async_write",false);
+  }
+
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("Averaging Type");
   m_avg_type = str2avg(avg_type);
@@ -276,6 +294,36 @@ void AtmosphereOutput::restart (const std::string& filename)
     const auto& dev  = m_dev_views_1d.at(name);
     Kokkos::deep_copy(dev,host);
   }
+
+  // Restore the number of masked samples of each entry, so that the averages
+  // are computed over the correct number of valid samples. Files written before
+  // these were stored do not have them, in which case all samples count as valid.
+  if (m_avg_type!=OutputAvgType::Instant) {
+    Kokkos::deep_copy(m_num_masked_real_h,0);
+    std::vector<std::string> nm_names;
+    std::map<std::string,view_1d_host> nm_views;
+    std::map<std::string,FieldLayout>  nm_layouts;
+    for (const auto& name : m_fields_names) {
+      const auto nm_name = name + "_num_masked";
+      if (scorpio::has_variable(filename,nm_name)) {
+        nm_names.push_back(nm_name);
+        nm_views.emplace(nm_name,m_num_masked_views_1d.at(name));
+        nm_layouts.emplace(nm_name,m_layouts.at(name));
+      }
+    }
+    if (nm_names.size()>0) {
+      ekat::ParameterList nm_params("Input Parameters");
+      nm_params.set<std::string>("Filename",filename);
+      nm_params.set("Field Names",nm_names);
+      AtmosphereInput nm_restart (nm_params,m_io_grid,nm_views,nm_layouts);
+      nm_restart.read_variables();
+      nm_restart.finalize();
+    }
+    for (size_t i=0; i<m_num_masked_h.size(); ++i) {
+      m_num_masked_h(i) = static_cast<int>(m_num_masked_real_h(i));
+    }
+    Kokkos::deep_copy(m_num_masked,m_num_masked_h);
+  }
 }
 
 void AtmosphereOutput::init()
@@ -339,12 +387,17 @@ run (const std::string& filename,
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
-  // Take care of updating and possibly writing fields.
+  // Gather the accumulation descriptors of all fields whose IO view does not alias the
+  // field view (for Instant output, there's no point in copying a field onto itself).
+  // Descriptors are rebuilt every time, since views of dynamic subfields may change,
+  // but they are copied to device only if something changed.
+  bool descs_changed = false;
+  int num_descs = 0;
+  int accum_size = 0;
   for (auto const& name : m_fields_names) {
     // Get all the info for this field.
           auto  field = get_field(name,"io");
     const auto& layout = m_layouts.at(name);
-    const auto& dims = layout.dims();
     const auto  rank = layout.rank();
 
     if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
@@ -363,102 +416,136 @@ run (const std::string& filename,
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
+    if (is_aliasing_field_view) {
+      continue;
+    }
 
-    // Manually update the 'running-tally' views with data from the field,
-    // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
-    auto view_dev = m_dev_views_1d.at(name);
-    auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
-
-    auto avg_type = m_avg_type;
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            combine(new_view_1d(i), avg_view_1d(i),avg_type);
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-          });
-          break;
+    OutputAccumDesc desc;
+    desc.dst = m_dev_views_1d.at(name).data();
+    desc.offset = accum_size;
+    switch (rank) {
+      // For rank-1 views, we use strided layout, since it helps us
+      // handling a few more scenarios
+      case 1: desc.set_src(field.get_strided_view<const Real*,Device>());       break;
+      case 2: desc.set_src(field.get_view<const Real**,Device>());              break;
+      case 3: desc.set_src(field.get_view<const Real***,Device>());             break;
+      case 4: desc.set_src(field.get_view<const Real****,Device>());            break;
+      case 5: desc.set_src(field.get_view<const Real*****,Device>());           break;
+      case 6: desc.set_src(field.get_view<const Real******,Device>());          break;
+      default:
+        EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+    }
+
+    auto& old_desc = m_accum_descs_h(num_descs);
+    if (std::memcmp(&old_desc,&desc,sizeof(OutputAccumDesc))!=0) {
+      old_desc = desc;
+      descs_changed = true;
+    }
+    ++num_descs;
+    accum_size += layout.size();
+  }
+
+  // Manually update the 'running-tally' views with data from the fields, by combining
+  // new data with current avg values. All fields are processed in a single kernel.
+  // At output steps, the same kernel also completes the averaging, if needed.
+  if (accum_size>0) {
+    if (descs_changed) {
+      Kokkos::deep_copy(m_accum_descs,m_accum_descs_h);
+    }
+
+    const auto descs = m_accum_descs;
+    const auto num_masked = m_num_masked;
+    const auto avg_type = m_avg_type;
+    const Real fill_value = m_fill_value;
+    const bool do_mask = avg_type!=OutputAvgType::Instant;
+    const bool do_average = avg_type==OutputAvgType::Average;
+    const int  nsteps = nsteps_since_last_output;
+    Kokkos::parallel_for(KT::RangePolicy(0,accum_size), KOKKOS_LAMBDA(const int idx) {
+      // Find the field containing this entry (descriptors are sorted by offset)
+      int lo = 0, hi = num_descs-1;
+      while (lo<hi) {
+        const int mid = (lo+hi+1)/2;
+        if (descs(mid).offset<=idx) {
+          lo = mid;
+        } else {
+          hi = mid-1;
         }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-          });
-          break;
+      }
+      const auto& desc = descs(lo);
+      const int i = idx - desc.offset;
+
+      Real& curr_val = desc.dst[i];
+      if (not do_mask) {
+        combine(desc.src[desc.src_idx(i)],curr_val,avg_type);
+        return;
+      }
+      combine_and_mask(desc.src[desc.src_idx(i)],curr_val,num_masked(idx),avg_type,fill_value);
+
+      // When the window is complete, entries with no valid sample are masked,
+      // and averages are computed over the valid samples only.
+      if (output_step) {
+        const int num_valid = nsteps - num_masked(idx);
+        if (num_valid<=0) {
+          curr_val = fill_value;
+        } else if (do_average) {
+          curr_val /= num_valid;
         }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
       }
+    });
+  }
+
+  if (not is_write_step) {
+    return;
+  }
+
+  // With async write, the host views hold the previous snapshot until the I/O thread
+  // has written it, so make sure that is done before overwriting them.
+  if (m_async_write) {
+    start_timer("EAMxx::IO::sync_io_tasks");
+    sync_io_tasks();
+    stop_timer("EAMxx::IO::sync_io_tasks");
+  }
+
+  auto handles_it = m_var_handles.find(filename);
+  EKAT_REQUIRE_MSG (handles_it!=m_var_handles.end(),
+      "Error! Variables were not registered in output file.\n"
+      " - filename: " + filename + "\n");
+  const auto& var_handles = handles_it->second;
+  for (size_t i=0; i<m_fields_names.size(); ++i) {
+    const auto& name = m_fields_names[i];
+    const auto& var  = var_handles[i];
+
+    // Bring data to host
+    auto view_dev  = m_dev_views_1d.at(name);
+    auto view_host = m_host_views_1d.at(name);
+    Kokkos::deep_copy (view_host,view_dev);
+    if (m_async_write) {
+      enqueue_io_task([=](){
+        grid_write_data_array(var,view_host.data(),view_host.size());
+      });
+    } else {
+      grid_write_data_array(var,view_host.data(),view_host.size());
     }
+  }
 
-    if (is_write_step) {
-      if (output_step and avg_type==OutputAvgType::Average) {
-        // Divide by steps count only when the summation is complete
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-          data[i] /= nsteps_since_last_output;
+  // History restart files also store the number of masked samples in the window
+  const auto nm_handles_it = m_num_masked_var_handles.find(filename);
+  if (nm_handles_it!=m_num_masked_var_handles.end()) {
+    Kokkos::deep_copy(m_num_masked_h,m_num_masked);
+    for (size_t i=0; i<m_num_masked_h.size(); ++i) {
+      m_num_masked_real_h(i) = m_num_masked_h(i);
+    }
+    const auto& nm_handles = nm_handles_it->second;
+    for (size_t i=0; i<m_fields_names.size(); ++i) {
+      const auto& var = nm_handles[i];
+      const auto view_host = m_num_masked_views_1d.at(m_fields_names[i]);
+      if (m_async_write) {
+        enqueue_io_task([=](){
+          grid_write_data_array(var,view_host.data(),view_host.size());
         });
+      } else {
+        grid_write_data_array(var,view_host.data(),view_host.size());
       }
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
     }
   }
 } // run
@@ -614,6 +701,7 @@ void AtmosphereOutput::register_dimensions(const std::string& name)
 void AtmosphereOutput::register_views()
 {
   // Cycle through all fields and register.
+  int accum_size = 0;
   for (auto const& name : m_fields_names) {
     auto field = get_field(name,"io");
     bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
@@ -639,14 +727,38 @@ void AtmosphereOutput::register_views()
     if (can_alias_field_view) {
       // Alias field's data, to save storage.
       m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
-      m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      if (m_async_write) {
+        // The host view must hold the snapshot until the I/O thread writes it,
+        // so it cannot alias the field's host data.
+        m_host_views_1d.emplace(name,view_1d_host("",size));
+      } else {
+        m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      }
     } else {
       // Create a local view.
       m_dev_views_1d.emplace(name,view_1d_dev("",size));
       m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
-
+      accum_size += size;
+    }
+  }
+  // Descriptors for the fused accumulation kernel (filled at every run call)
+  m_accum_descs = decltype(m_accum_descs)("accum_descs",m_fields_names.size());
+  m_accum_descs_h = Kokkos::create_mirror_view(m_accum_descs);
+  if (m_avg_type!=OutputAvgType::Instant) {
+    m_num_masked = decltype(m_num_masked)("num_masked",accum_size);
+    m_num_masked_h = Kokkos::create_mirror_view(m_num_masked);
+    m_num_masked_real_h = view_1d_host("num_masked",accum_size);
+
+    // For non-instant output, no field view is aliased, so the entries of
+    // each field are stored contiguously, in the order of m_fields_names.
+    int offset = 0;
+    for (const auto& name : m_fields_names) {
+      const auto size = m_layouts.at(name).size();
+      m_num_masked_views_1d.emplace(name,view_1d_host(m_num_masked_real_h.data()+offset,size));
+      offset += size;
     }
   }
+
   // Initialize the local views
   reset_dev_views();
 }
@@ -674,15 +786,41 @@ reset_dev_views()
         EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
     }
   }
+  if (m_avg_type!=OutputAvgType::Instant) {
+    Kokkos::deep_copy(m_num_masked,0);
+  }
 }
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
 register_variables(const std::string& filename,
-                   const std::string& fp_precision)
+                   const std::string& fp_precision,
+                   const bool is_checkpoint_file)
 {
   using namespace scorpio;
   using namespace ShortFieldTagsNames;
 
+  // Drop handles of files that have been closed in the meantime
+  for (auto it=m_var_handles.begin(); it!=m_var_handles.end(); ) {
+    if (is_file_open_c2f(it->first.c_str(),-1)) {
+      ++it;
+    } else {
+      it = m_var_handles.erase(it);
+    }
+  }
+  for (auto it=m_num_masked_var_handles.begin(); it!=m_num_masked_var_handles.end(); ) {
+    if (is_file_open_c2f(it->first.c_str(),-1)) {
+      ++it;
+    } else {
+      it = m_num_masked_var_handles.erase(it);
+    }
+  }
+  auto& var_handles = m_var_handles[filename];
+  var_handles.clear();
+  const bool add_num_masked = is_checkpoint_file and m_avg_type!=OutputAvgType::Instant;
+  if (add_num_masked) {
+    m_num_masked_var_handles[filename].clear();
+  }
+
   // Cycle through all fields and register.
   for (auto const& name : m_fields_names) {
     auto field = get_field(name,"io");
@@ -726,8 +864,15 @@ register_variables(const std::string& filename,
     // Currently the field_manager only stores Real variables so it is not an issue,
     // but in the future if non-Real variables are added we will want to accomodate that.
 
-    register_variable(filename, name, name, units, vec_of_dims,
-                      "real",fp_precision, io_decomp_tag);
+    // Store the variable handle, so we don't need to lookup the var by name during writes.
+    var_handles.push_back(register_variable(filename, name, name, units, vec_of_dims,
+                                            "real",fp_precision, io_decomp_tag));
+    if (add_num_masked) {
+      const auto nm_name = name + "_num_masked";
+      m_num_masked_var_handles[filename].push_back(
+          register_variable(filename, nm_name, nm_name, "1", vec_of_dims,
+                            "real",fp_precision, io_decomp_tag));
+    }
 
     // Add any extra attributes for this variable, examples include:
     //   1. A list of subfields associated with a field group output
@@ -834,7 +979,8 @@ AtmosphereOutput::get_var_dof_offsets(const FieldLayout& layout)
   return var_dof;
 }
 /* ---------------------------------------------------------- */
-void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
+void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename,
+                                              const bool is_checkpoint_file)
 {
   using namespace scorpio;
   using namespace ShortFieldTagsNames;
@@ -846,6 +992,9 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
     auto var_dof = get_var_dof_offsets(fid.get_layout());
     set_dof(filename,name,var_dof.size(),var_dof.data());
     m_dofs.emplace(std::make_pair(name,var_dof.size()));
+    if (is_checkpoint_file and m_avg_type!=OutputAvgType::Instant) {
+      set_dof(filename,name+"_num_masked",var_dof.size(),var_dof.data());
+    }
   }
 
   /* TODO:
@@ -855,7 +1004,8 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
-                  const std::string& fp_precision)
+                  const std::string& fp_precision,
+                  const bool is_checkpoint_file)
 {
   using namespace scream::scorpio;
 
@@ -865,10 +1015,10 @@ setup_output_file(const std::string& filename,
   }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision);
+  register_variables(filename,fp_precision,is_checkpoint_file);
 
   // Set the offsets of the local dofs in the global vector.
-  set_degrees_of_freedom(filename);
+  set_degrees_of_freedom(filename,is_checkpoint_file);
 }
 /* ---------------------------------------------------------- */
 // This routine will evaluate the diagnostics stored in this
@@ -42,6 +42,7 @@
  *  output_control:
  *    Frequency:                  INT
  *    frequency_units:            STRING                (default: nsteps)
+ *    async_write:                BOOL                  (default: false)
  *  Restart:
  *    filename_prefix:            STRING                (default: ${filename_prefix})
  *    Perform Restart:            BOOL                  (default: true)
@@ -66,6 +67,10 @@
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
  *      snapshots have been written on a single nc file, the class will close the file, and open a new one
+ *    - async_write: if true, at write steps the data is copied in a separate host buffer, and
+ *      the actual write is queued on the scorpio I/O thread (see scream_scorpio_interface.hpp),
+ *      so that the model can proceed while data is written. The OutputManager resets this
+ *      option to false if the I/O thread cannot be started.
  *  - Checkpointing: parameters for checkpointing control
  *    - Frequency: the frequenct of checkpoints writes. This option is used/matters only if
  *      if Averaging Type is *not* Instant. A value of 0 is interpreted as 'no checkpointing'.
@@ -103,6 +108,43 @@
 namespace scream
 {
 
+// Describes how to accumulate one field into its 'running-tally' view. The descriptors
+// of all fields in a stream are stored in one device view, and the accumulation is
+// performed in a single kernel over the flattened index space of all fields, where the
+// entries of each field start at 'offset'. Since the tally view is contiguous (LayoutRight),
+// only the field view needs strides.
+struct OutputAccumDesc {
+  static constexpr int MaxRank = 6;
+
+  const Real* src = nullptr;
+  Real*       dst = nullptr;
+  int rank    = 0;
+  int offset  = 0;
+  int extents[MaxRank] = {0};
+  int strides[MaxRank] = {0};
+
+  template<typename ViewT>
+  void set_src (const ViewT& v) {
+    src  = v.data();
+    rank = ViewT::rank;
+    for (int i=0; i<rank; ++i) {
+      extents[i] = v.extent_int(i);
+      strides[i] = static_cast<int>(v.stride(i));
+    }
+  }
+
+  // Given the index i of an entry in the flattened field, get its offset in src
+  KOKKOS_INLINE_FUNCTION
+  int src_idx (int i) const {
+    int idx = 0;
+    for (int k=rank-1; k>=0; --k) {
+      idx += (i % extents[k])*strides[k];
+      i /= extents[k];
+    }
+    return idx;
+  }
+};
+
 class AtmosphereOutput
 {
 public:
@@ -137,7 +179,10 @@ public:
   void restart (const std::string& filename);
   void init();
   void reset_dev_views();
-  void setup_output_file (const std::string& filename, const std::string& fp_precision);
+  // In history restart files, for non-instant output, also store the number of
+  // masked samples of each entry in the current window.
+  void setup_output_file (const std::string& filename, const std::string& fp_precision,
+                          const bool is_checkpoint_file = false);
   void run (const std::string& filename,
             const bool output_step, const bool checkpoint_step,
             const int nsteps_since_last_output,
@@ -158,8 +203,9 @@ protected:
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
 
   void register_dimensions(const std::string& name);
-  void register_variables(const std::string& filename, const std::string& fp_precision);
-  void set_degrees_of_freedom(const std::string& filename);
+  void register_variables(const std::string& filename, const std::string& fp_precision,
+                          const bool is_checkpoint_file);
+  void set_degrees_of_freedom(const std::string& filename, const bool is_checkpoint_file);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
   Field get_field(const std::string& name, const std::string mode) const;
@@ -204,7 +250,30 @@ protected:
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Handles of the output variables in each file, ordered as m_fields_names
+  std::map<std::string,std::vector<scorpio::VarHandle>>  m_var_handles;
+
+  // Descriptors for the accumulation of all fields in a single kernel (see OutputAccumDesc)
+  KT::view_1d<OutputAccumDesc>                m_accum_descs;
+  KT::view_1d<OutputAccumDesc>::HostMirror    m_accum_descs_h;
+
+  // For each entry of the 'running-tally' views (in the flattened index space of
+  // OutputAccumDesc), the number of samples in the current window equal to the
+  // fill value. These are excluded from Max/Min/Average (not used for Instant).
+  KT::view_1d<int>                            m_num_masked;
+
+  // Host copies of m_num_masked, to write/read it to/from history restart files.
+  // For each field, the variable <field name>_num_masked stores its entries, which
+  // are exposed as Real in m_num_masked_views_1d.
+  KT::view_1d<int>::HostMirror                m_num_masked_h;
+  view_1d_host                                m_num_masked_real_h;
+  std::map<std::string,view_1d_host>          m_num_masked_views_1d;
+  std::map<std::string,std::vector<scorpio::VarHandle>>  m_num_masked_var_handles;
+
   bool m_add_time_dim;
+
+  // If true, host views never alias field data, and writes are deferred to the I/O thread
+  bool m_async_write = false;
 };
 
 } //namespace scream
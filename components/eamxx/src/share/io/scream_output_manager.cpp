@@ -9,6 +9,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <fstream>
+#include <functional>
 #include <memory>
 
 namespace scream
@@ -85,6 +86,19 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   m_output_file_specs.filename_with_mpiranks = out_control_pl.get("MPI Ranks in Filename",false);
   m_output_file_specs.save_grid_data         = out_control_pl.get("save_grid_data",!m_is_model_restart_output);
 
+  // Asynchronous write. Model restart files are always written synchronously.
+  // Store the final choice in the params, since output streams need it too.
+  m_async_write = out_control_pl.get("async_write",false) && not m_is_model_restart_output;
+  if (m_async_write) {
+    m_async_write = scorpio::start_io_thread();
+    if (not m_async_write and m_atm_logger) {
+      m_atm_logger->warn(
+          "[EAMxx::output_manager] WARNING: asynchronous write was requested, but MPI was not\n"
+          "   initialized with MPI_THREAD_MULTIPLE support. Output will be written synchronously.\n");
+    }
+  }
+  out_control_pl.set("async_write",m_async_write);
+
   // Here, store if PG2 fields will be present in output streams.
   // Will be useful if multiple grids are defined (see below).
   bool pg2_grid_in_io_streams = false;
@@ -320,6 +334,16 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
   using namespace scorpio;
 
+  // With async write, scorpio calls on the file must follow the (deferred) fields writes,
+  // so they are queued on the I/O thread as well. Anything they need is captured by value.
+  auto io_call = [&](std::function<void()>&& f) {
+    if (m_async_write) {
+      enqueue_io_task(std::move(f));
+    } else {
+      f();
+    }
+  };
+
   std::string timer_root = m_is_model_restart_output ? "EAMxx::IO::restart" : "EAMxx::IO::standard";
   start_timer(timer_root);
   // Check if we need to open a new file
@@ -391,14 +415,18 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     setup_output_file(m_output_control,m_output_file_specs,m_is_model_restart_output,m_is_model_restart_output ? "model restart" : "model output");
 
     // Update time (must be done _before_ writing fields)
-    pio_update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
+    const auto& filename = m_output_file_specs.filename;
+    const auto time = timestamp.days_from(m_case_t0);
+    io_call([=](){ pio_update_time(filename,time); });
   }
   if (is_checkpoint_step) {
     setup_output_file(m_checkpoint_control,m_checkpoint_file_specs,true,"history restart");
 
     if (is_full_checkpoint_step) {
       // Update time (must be done _before_ writing fields)
-      pio_update_time(m_checkpoint_file_specs.filename,timestamp.days_from(m_case_t0));
+      const auto& filename = m_checkpoint_file_specs.filename;
+      const auto time = timestamp.days_from(m_case_t0);
+      io_call([=](){ pio_update_time(filename,time); });
     }
   }
   stop_timer(timer_root+"::get_new_file");
@@ -425,47 +453,63 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
 
     auto write_global_data = [&](IOControl& control, IOFileSpecs& filespecs) {
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"nsteps",timestamp.get_num_steps());
-      } else {
-        if (filespecs.hist_restart_file) {
-          // Update the date of last write and sample size
-          scorpio::write_timestamp (filespecs.filename,"last_write",m_output_control.timestamp_of_last_write);
-          scorpio::set_attribute (filespecs.filename,"last_output_filename",m_output_file_specs.filename);
-          scorpio::set_attribute (filespecs.filename,"num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
+      const auto filename = filespecs.filename;
+      const auto nsteps = timestamp.get_num_steps();
+      const auto last_write = m_output_control.timestamp_of_last_write;
+      const auto last_output_filename = m_output_file_specs.filename;
+      const auto nsamples = m_output_control.nsamples_since_last_write;
+      const auto avg_type = e2str(m_avg_type);
+      const auto freq_units = m_output_control.frequency_units;
+      const auto freq = m_output_control.frequency;
+      const auto max_snaps = m_output_file_specs.max_snapshots_in_file;
+      const auto fp_precision = m_params.get<std::string>("Floating Point Precision");
+      const auto is_model_restart_output = m_is_model_restart_output;
+      const auto hist_restart_file = filespecs.hist_restart_file;
+      const auto globals = m_globals;
+      const auto time_bnds = m_time_bnds;
+
+      io_call([=](){
+        if (is_model_restart_output) {
+          // Only write nsteps on model restart
+          set_attribute(filename,"nsteps",nsteps);
+        } else {
+          if (hist_restart_file) {
+            // Update the date of last write and sample size
+            scorpio::write_timestamp (filename,"last_write",last_write);
+            scorpio::set_attribute (filename,"last_output_filename",last_output_filename);
+            scorpio::set_attribute (filename,"num_snapshots_since_last_write",nsamples);
+          }
+          // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
+          // output, and the latter b/c we want to make sure these params don't change across restarts
+          set_attribute(filename,"averaging_type",avg_type);
+          set_attribute(filename,"averaging_frequency_units",freq_units);
+          set_attribute(filename,"averaging_frequency",freq);
+          set_attribute(filename,"max_snapshots_per_file",max_snaps);
+          set_attribute(filename,"fp_precision",fp_precision);
         }
-        // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
-        // output, and the latter b/c we want to make sure these params don't change across restarts
-        set_attribute(filespecs.filename,"averaging_type",e2str(m_avg_type));
-        set_attribute(filespecs.filename,"averaging_frequency_units",m_output_control.frequency_units);
-        set_attribute(filespecs.filename,"averaging_frequency",m_output_control.frequency);
-        set_attribute(filespecs.filename,"max_snapshots_per_file",m_output_file_specs.max_snapshots_in_file);
-        const auto& fp_precision = m_params.get<std::string>("Floating Point Precision");
-        set_attribute(filespecs.filename,"fp_precision",fp_precision);
-      }
 
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        set_any_attribute(filespecs.filename,name,any);
-      }
+        // Write all stored globals
+        for (const auto& it : globals) {
+          const auto& name = it.first;
+          const auto& any = it.second;
+          set_any_attribute(filename,name,any);
+        }
+
+        if (time_bnds.size()>0) {
+          scorpio::grid_write_data_array(filename, "time_bnds", time_bnds.data(), 2);
+        }
+      });
 
       // We're adding one snapshot to the file
       ++filespecs.num_snapshots_in_file;
 
-      if (m_time_bnds.size()>0) {
-        scorpio::grid_write_data_array(filespecs.filename, "time_bnds", m_time_bnds.data(), 2);
-      }
-
       // Since we wrote to file we need to reset the nsamples_since_last_write, the timestamp ...
       control.nsamples_since_last_write = 0;
       control.timestamp_of_last_write = timestamp;
 
       // Check if we need to close the output file
       if (filespecs.file_is_full()) {
-        eam_pio_closefile(filespecs.filename);
+        io_call([=](){ eam_pio_closefile(filename); });
         filespecs.num_snapshots_in_file = 0;
         filespecs.is_open = false;
       }
@@ -492,6 +536,9 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Make sure all deferred writes (if any) are done
+  scorpio::sync_io_tasks();
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::eam_pio_closefile (m_output_file_specs.filename);
@@ -666,7 +713,7 @@ setup_file (      IOFileSpecs& filespecs,
 
   // Make all output streams register their dims/vars
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision);
+    it->setup_output_file(filename,fp_precision,is_checkpoint_step);
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
@@ -739,6 +786,7 @@ push_to_logger()
   m_atm_logger->info("          Output Frequency: " + std::to_string(m_output_control.frequency) + " " + m_output_control.frequency_units);
   m_atm_logger->info("         Max snaps in file: " + std::to_string(m_output_file_specs.max_snapshots_in_file));  // TODO: add "not set" if the value is -1
   m_atm_logger->info("      Includes Grid Data ?: " + bool_to_string(m_output_file_specs.save_grid_data));
+  m_atm_logger->info("     Asynchronous Write ?: " + bool_to_string(m_async_write));
   // List each GRID - TODO
   // List all FIELDS - TODO
 
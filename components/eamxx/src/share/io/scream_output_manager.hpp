@@ -172,6 +172,9 @@ protected:
   // If the user specifies freq units "none" or "never", output is disabled
   bool m_output_disabled = false;
 
+  // If true, field writes and the subsequent scorpio calls are queued on the I/O thread
+  bool m_async_write = false;
+
   // The initial time stamp of the simulation and run. For initial runs, they coincide,
   // but for restarted runs, run_t0>case_t0, with the former being the time at which the
   // restart happens, and the latter being the start time of the *original* run.
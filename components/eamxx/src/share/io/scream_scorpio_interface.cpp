@@ -7,7 +7,12 @@
 
 #include <pio.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
 
 
 using scream::Real;
@@ -26,6 +31,13 @@ extern "C" {
   void grid_write_data_array_c2f_int(const char*&& filename, const char*&& varname, const int* buf, const int buf_size);
   void grid_write_data_array_c2f_float(const char*&& filename, const char*&& varname, const float* buf, const int buf_size);
   void grid_write_data_array_c2f_double(const char*&& filename, const char*&& varname, const double* buf, const int buf_size);
+  void get_var_handle_c2f(const char*&& filename, const char*&& varname, void** file, void** var);
+  void grid_read_var_data_array_c2f_int(void* file, void* var, const Int time_index, int *buf, const int buf_size);
+  void grid_read_var_data_array_c2f_float(void* file, void* var, const Int time_index, float *buf, const int buf_size);
+  void grid_read_var_data_array_c2f_double(void* file, void* var, const Int time_index, double *buf, const int buf_size);
+  void grid_write_var_data_array_c2f_int(void* file, void* var, const int* buf, const int buf_size);
+  void grid_write_var_data_array_c2f_float(void* file, void* var, const float* buf, const int buf_size);
+  void grid_write_var_data_array_c2f_double(void* file, void* var, const double* buf, const int buf_size);
   void eam_init_pio_subsystem_c2f(const int mpicom, const int atm_id);
   void eam_pio_finalize_c2f();
   void eam_pio_closefile_c2f(const char*&& filename);
@@ -43,6 +55,123 @@ extern "C" {
 namespace scream {
 namespace scorpio {
 
+namespace {
+
+// The queue of deferred scorpio calls, together with the thread executing them
+struct IOTaskQueue {
+  ~IOTaskQueue () { stop(); }
+
+  bool is_running () const { return worker.joinable(); }
+  bool on_worker () const { return std::this_thread::get_id()==worker.get_id(); }
+
+  void start () {
+    worker = std::thread([this](){ run(); });
+  }
+
+  void stop () {
+    if (not is_running()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      done = true;
+    }
+    cv.notify_all();
+    worker.join();
+    done = false;
+  }
+
+  void run () {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cv.wait(lock,[&]{ return done or not tasks.empty(); });
+      if (tasks.empty()) {
+        return;
+      }
+      auto task = std::move(tasks.front());
+      tasks.pop_front();
+
+      // After a failure, the file state is unreliable: drop remaining tasks
+      if (error) {
+        continue;
+      }
+
+      busy = true;
+      lock.unlock();
+      std::exception_ptr err;
+      try {
+        task();
+      } catch (...) {
+        err = std::current_exception();
+      }
+      lock.lock();
+      busy = false;
+      error = err;
+      cv.notify_all();
+    }
+  }
+
+  std::thread                         worker;
+  std::mutex                          mutex;
+  std::condition_variable             cv;
+  std::deque<std::function<void()>>   tasks;
+  std::exception_ptr                  error;
+  bool                                busy = false;
+  bool                                done = false;
+};
+
+IOTaskQueue& io_tasks () {
+  static IOTaskQueue q;
+  return q;
+}
+
+} // anonymous namespace
+
+/* ----------------------------------------------------------------- */
+bool start_io_thread () {
+  auto& q = io_tasks();
+  if (q.is_running()) {
+    return true;
+  }
+
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided<MPI_THREAD_MULTIPLE) {
+    return false;
+  }
+
+  q.start();
+  return true;
+}
+/* ----------------------------------------------------------------- */
+void enqueue_io_task (std::function<void()>&& task) {
+  auto& q = io_tasks();
+  if (not q.is_running() or q.on_worker()) {
+    sync_io_tasks();
+    task();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(q.mutex);
+    q.tasks.emplace_back(std::move(task));
+  }
+  q.cv.notify_all();
+}
+/* ----------------------------------------------------------------- */
+void sync_io_tasks () {
+  auto& q = io_tasks();
+  if (not q.is_running() or q.on_worker()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(q.mutex);
+  q.cv.wait(lock,[&]{ return q.tasks.empty() and not q.busy; });
+  if (q.error) {
+    auto err = q.error;
+    q.error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
 // Retrieve the int codes PIO uses to specify data types
 int nctype (const std::string& type) {
   if (type=="int") {
@@ -85,25 +214,30 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  sync_io_tasks();
+  io_tasks().stop();
   eam_pio_finalize_c2f();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
+  sync_io_tasks();
   register_file_c2f(filename.c_str(),mode);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
-
+  sync_io_tasks();
   eam_pio_closefile_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void set_decomp(const std::string& filename) {
-
+  sync_io_tasks();
   set_decomp_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 int get_dimlen(const std::string& filename, const std::string& dimname)
 {
+  sync_io_tasks();
+
   int ncid, dimid, err;
   PIO_Offset len;
 
@@ -141,6 +275,8 @@ int get_dimlen(const std::string& filename, const std::string& dimname)
 /* ----------------------------------------------------------------- */
 bool has_variable (const std::string& filename, const std::string& varname)
 {
+  sync_io_tasks();
+
   int ncid, varid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -151,6 +287,9 @@ bool has_variable (const std::string& filename, const std::string& varname)
   ncid = get_file_ncid_c2f (filename.c_str());
   err = PIOc_inq_varid(ncid,varname.c_str(),&varid);
   if (err==PIO_ENOTVAR) {
+    if (not was_open) {
+      eam_pio_closefile(filename);
+    }
     return false;
   }
   EKAT_REQUIRE_MSG (err==PIO_NOERR,
@@ -166,17 +305,19 @@ bool has_variable (const std::string& filename, const std::string& varname)
 }
 /* ----------------------------------------------------------------- */
 void set_dof(const std::string& filename, const std::string& varname, const Int dof_len, const std::int64_t* x_dof) {
-
+  sync_io_tasks();
   set_dof_c2f(filename.c_str(),varname.c_str(),dof_len,x_dof);
 }
 /* ----------------------------------------------------------------- */
 void pio_update_time(const std::string& filename, const double time) {
-
+  sync_io_tasks();
   pio_update_time_c2f(filename.c_str(),time);
 }
 /* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length, const bool partitioned)
 {
+  sync_io_tasks();
+
   int mode = get_file_mode_c2f(filename.c_str());
   std::string mode_str = mode==Read ? "Read" : (mode==Write ? "Write" : "Append");
   if (mode!=Write) {
@@ -222,9 +363,9 @@ void register_dimension(const std::string &filename, const std::string& shortnam
   register_dimension_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), length, partitioned);
 }
 /* ----------------------------------------------------------------- */
-void register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
-                       const std::vector<std::string>& var_dimensions,
-                       const std::string& dtype, const std::string& pio_decomp_tag)
+VarHandle register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
+                            const std::vector<std::string>& var_dimensions,
+                            const std::string& dtype, const std::string& pio_decomp_tag)
 {
   // This overload does not require to specify an nc data type, so it *MUST* be used when the
   // file access mode is either Read or Append. Either way, a) the var should be on file already,
@@ -239,12 +380,14 @@ void register_variable(const std::string& filename, const std::string& shortname
     //          If this dim should be partitioned, then register it *before* the variable
     register_dimension(filename,dimname,dimname,len,false);
   }
-  register_variable(filename,shortname,longname,"",var_dimensions,dtype,"",pio_decomp_tag);
+  return register_variable(filename,shortname,longname,"",var_dimensions,dtype,"",pio_decomp_tag);
 }
-void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
-                       const std::string& units_in, const std::vector<std::string>& var_dimensions,
-                       const std::string& dtype, const std::string& nc_dtype_in, const std::string& pio_decomp_tag)
+VarHandle register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
+                            const std::string& units_in, const std::vector<std::string>& var_dimensions,
+                            const std::string& dtype, const std::string& nc_dtype_in, const std::string& pio_decomp_tag)
 {
+  sync_io_tasks();
+
   // Local copies, since we can modify them in case of defaults
   auto units = units_in;
   auto nc_dtype = nc_dtype_in;
@@ -379,9 +522,28 @@ void register_variable(const std::string &filename, const std::string& shortname
   register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(),
                         units.c_str(), numdims, var_dimensions_c.data(),
                         nctype(dtype), nctype(nc_dtype), pio_decomp_tag.c_str());
+
+  return get_var_handle(filename,shortname);
+}
+/* ----------------------------------------------------------------- */
+VarHandle get_var_handle (const std::string& filename, const std::string& varname)
+{
+  sync_io_tasks();
+
+  VarHandle h;
+  h.filename = filename;
+  h.varname  = varname;
+  get_var_handle_c2f(filename.c_str(),varname.c_str(),&h.file,&h.var);
+  EKAT_REQUIRE_MSG (h.is_valid(),
+      "Error! Could not retrieve variable handle. Is the file open?\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  return h;
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val) {
+  sync_io_tasks();
   set_variable_metadata_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
 }
 /* ----------------------------------------------------------------- */
@@ -391,6 +553,7 @@ ekat::any get_any_attribute (const std::string& filename, const std::string& att
 }
 /* ----------------------------------------------------------------- */
 ekat::any get_any_attribute (const std::string& filename, const std::string& var_name, const std::string& att_name) {
+  sync_io_tasks();
   register_file(filename,Read);
   auto ncid = get_file_ncid_c2f (filename.c_str());
   EKAT_REQUIRE_MSG (ncid>=0,
@@ -464,6 +627,7 @@ ekat::any get_any_attribute (const std::string& filename, const std::string& var
   return att;
 }
 void set_any_attribute (const std::string& filename, const std::string& att_name, const ekat::any& att) {
+  sync_io_tasks();
   auto ncid = get_file_ncid_c2f (filename.c_str());
   int err;
 
@@ -519,42 +683,88 @@ void set_any_attribute (const std::string& filename, const std::string& att_name
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
+  sync_io_tasks();
   eam_pio_enddef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_redef(const std::string &filename) {
+  sync_io_tasks();
   eam_pio_redef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_write_data_array<int>(const std::string &filename, const std::string &varname, const int* hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_write_data_array_c2f_int(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<float>(const std::string &filename, const std::string &varname, const float* hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_write_data_array_c2f_float(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<double>(const std::string &filename, const std::string &varname, const double* hbuf, const int buf_size) {
+  sync_io_tasks();
   grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
+template<>
+void grid_read_data_array<int>(const VarHandle& var, const int time_index, int *hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_read_var_data_array_c2f_int(var.file,var.var,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<float>(const VarHandle& var, const int time_index, float *hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_read_var_data_array_c2f_float(var.file,var.var,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<double>(const VarHandle& var, const int time_index, double *hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_read_var_data_array_c2f_double(var.file,var.var,time_index,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
+template<>
+void grid_write_data_array<int>(const VarHandle& var, const int* hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_write_var_data_array_c2f_int(var.file,var.var,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<float>(const VarHandle& var, const float* hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_write_var_data_array_c2f_float(var.file,var.var,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<double>(const VarHandle& var, const double* hbuf, const int buf_size) {
+  EKAT_REQUIRE_MSG (var.is_valid(), "Error! Invalid variable handle for '" + var.varname + "'.\n");
+  sync_io_tasks();
+  grid_write_var_data_array_c2f_double(var.file,var.var,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
 void write_timestamp (const std::string& filename, const std::string& ts_name, const util::TimeStamp& ts)
 {
   set_attribute(filename,ts_name,ts.to_string());
@@ -8,6 +8,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <functional>
 #include <vector>
 
 /* C++/F90 bridge to F90 SCORPIO routines */
@@ -41,13 +42,25 @@ namespace scorpio {
   void set_dof(const std::string &filename, const std::string &varname, const Int dof_len, const offset_t* x_dof);
   /* Register a dimension coordinate with a file. Called during the file setup. */
   void register_dimension(const std::string& filename,const std::string& shortname, const std::string& longname, const int length, const bool partitioned);
+  /* Opaque handle to a variable registered in a file. Reading/writing through a handle avoids
+   * looking up the file and the variable by name at every call. A handle is valid until the file
+   * is closed, and must not be used afterwards (even if a file with the same name is re-opened). */
+  struct VarHandle {
+    void* file = nullptr;
+    void* var  = nullptr;
+    std::string filename;
+    std::string varname;
+
+    bool is_valid () const { return file!=nullptr && var!=nullptr; }
+  };
+  VarHandle get_var_handle (const std::string& filename, const std::string& varname);
   /* Register a variable with a file.  Called during the file setup, for an output stream. */
-  void register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
-                         const std::string& units, const std::vector<std::string>& var_dimensions,
-                         const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag);
-  void register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
-                         const std::vector<std::string>& var_dimensions,
-                         const std::string& dtype, const std::string& pio_decomp_tag);
+  VarHandle register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
+                              const std::string& units, const std::vector<std::string>& var_dimensions,
+                              const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag);
+  VarHandle register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
+                              const std::vector<std::string>& var_dimensions,
+                              const std::string& dtype, const std::string& pio_decomp_tag);
   void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val);
   /* Register a variable with a file.  Called during the file setup, for an input stream. */
   ekat::any get_any_attribute (const std::string& filename, const std::string& att_name);
@@ -70,6 +83,11 @@ namespace scorpio {
   template<typename T>
   void grid_write_data_array(const std::string &filename, const std::string &varname,
                              const T* hbuf, const int buf_size);
+  /* Same as above, but using a handle returned by register_variable/get_var_handle */
+  template<typename T>
+  void grid_read_data_array (const VarHandle& var, const int time_index, T* hbuf, const int buf_size);
+  template<typename T>
+  void grid_write_data_array(const VarHandle& var, const T* hbuf, const int buf_size);
 
   template<typename T>
   T get_attribute (const std::string& filename, const std::string& att_name)
@@ -89,6 +107,18 @@ namespace scorpio {
   void write_timestamp (const std::string& filename, const std::string& ts_name, const util::TimeStamp& ts);
   util::TimeStamp read_timestamp (const std::string& filename, const std::string& ts_name);
 
+  /* Deferred scorpio calls. Tasks are executed, in the order they were enqueued, by a single
+   * background I/O thread. Every other scorpio call issued by the main thread first waits for
+   * all pending tasks to complete, so that scorpio is never entered by two threads at once,
+   * and collective operations are issued in the same order on all ranks.
+   * Since the I/O thread performs MPI calls concurrently with the main thread, the thread
+   * can only be started if MPI was initialized with MPI_THREAD_MULTIPLE; start_io_thread
+   * returns false otherwise. If the thread is not running, tasks are executed immediately. */
+  bool start_io_thread ();
+  void enqueue_io_task (std::function<void()>&& task);
+  /* Wait for all pending tasks. Rethrows the first exception thrown by a task, if any. */
+  void sync_io_tasks ();
+
 extern "C" {
   /* Query whether the pio subsystem is inited or not */
   bool is_eam_pio_subsystem_inited();
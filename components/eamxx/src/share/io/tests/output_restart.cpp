@@ -43,6 +43,8 @@ void time_advance (const FieldManager& fm,
                    const std::list<ekat::CaseInsensitiveString>& fnames,
                    const int dt);
 
+void set_masked_field (const FieldManager& fm, const util::TimeStamp& time);
+
 TEST_CASE("output_restart","io")
 {
   // Note to AaronDonahue:  You are trying to figure out why you can't change the number of cols and levs for this test.  
@@ -74,7 +76,7 @@ TEST_CASE("output_restart","io")
   // Create output params (some options are set below, depending on the run type
   ekat::ParameterList output_params;
   output_params.set<std::string>("Floating Point Precision","real");
-  output_params.set<std::vector<std::string>>("Field Names",{"field_1", "field_2", "field_3", "field_4"});
+  output_params.set<std::vector<std::string>>("Field Names",{"field_1", "field_2", "field_3", "field_4", "field_5"});
   output_params.sublist("output_control").set<bool>("MPI Ranks in Filename","true");
   output_params.sublist("output_control").set<std::string>("frequency_units","nsteps");
   output_params.sublist("output_control").set<int>("Frequency",10);
@@ -99,6 +101,7 @@ TEST_CASE("output_restart","io")
     for (int i=0; i<nsteps; ++i) {
       time_advance(*fm,out_fields,dt);
       time += dt;
+      set_masked_field(*fm,time);
       output_manager.run(time);
     }
     output_manager.finalize();
@@ -178,6 +181,8 @@ get_test_fm(const std::shared_ptr<const AbstractGrid>& grid)
   FieldIdentifier fid2("field_2",FL{tag_v,dims_v},kg,gn);
   FieldIdentifier fid3("field_3",FL{tag_2d,dims_2d},kg/m,gn);
   FieldIdentifier fid4("field_4",FL{tag_3d,dims_3d},kg/m,gn);
+  // Contains fill values, set at each step by set_masked_field
+  FieldIdentifier fid5("field_5",FL{tag_h,dims_h},m,gn);
 
   // Register fields with fm
   fm->registration_begins();
@@ -185,12 +190,13 @@ get_test_fm(const std::shared_ptr<const AbstractGrid>& grid)
   fm->register_field(FR{fid2,SL{"output"}});
   fm->register_field(FR{fid3,SL{"output"}});
   fm->register_field(FR{fid4,SL{"output"}});
+  fm->register_field(FR{fid5});
   fm->registration_ends();
 
   // Initialize fields to -1.0, and set initial time stamp
   util::TimeStamp time ({2000,1,1},{0,0,0});
   fm->init_fields_time_stamp(time);
-  for (const auto& fn : {"field_1","field_2","field_3","field_4"} ) {
+  for (const auto& fn : {"field_1","field_2","field_3","field_4","field_5"} ) {
     fm->get_field(fn).deep_copy(-1.0);
     fm->get_field(fn).sync_to_host();
   }
@@ -285,6 +291,23 @@ void time_advance (const FieldManager& fm,
   }
 }
 
+/*===================================================================================================*/
+// Set field_5 to a value that depends on the time step, except for the entries that
+// are masked (i.e., equal to the fill value) at this step: column 0 is always masked,
+// while the others are masked every 4 steps, so that the masked samples of an output
+// window are both before and after the restart.
+void set_masked_field (const FieldManager& fm, const util::TimeStamp& time)
+{
+  const int n = time.get_num_steps();
+  auto f = fm.get_field("field_5");
+  auto v = f.get_view<Real*,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    v(i) = (i==0 or n%4==2) ? DEFAULT_FILL_VALUE : n+i;
+  }
+  f.sync_to_dev();
+  f.get_header().get_tracking().update_time_stamp(time);
+}
+
 std::shared_ptr<FieldManager>
 backup_fm (const std::shared_ptr<FieldManager>& src_fm)
 {
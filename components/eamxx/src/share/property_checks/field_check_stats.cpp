@@ -0,0 +1,189 @@
+#include "share/property_checks/field_check_stats.hpp"
+#include "share/util/scream_array_utils.hpp"
+
+#include <ekat/util/ekat_math_utils.hpp>
+
+namespace scream
+{
+
+// NOTE: CUDA does not allow extended lambdas inside functions with internal linkage,
+//       so we cannot use an anonymous namespace here.
+namespace impl {
+
+template<typename ST>
+struct FieldCheckStatsValue {
+  ST  min_val;
+  ST  max_val;
+  int min_loc;
+  int max_loc;
+  int invalid_loc;
+};
+
+// For Kokkos::parallel_reduce. Combines MinMaxLoc with a Max<int> on the
+// flattened idx of invalid entries, so that a single pass is enough.
+template<typename ST>
+struct FieldCheckStatsReducer {
+  using reducer = FieldCheckStatsReducer;
+  using value_type = FieldCheckStatsValue<ST>;
+  using result_view_type = Kokkos::View<value_type, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+
+  KOKKOS_INLINE_FUNCTION FieldCheckStatsReducer (value_type& value_) : value(value_) {}
+
+  KOKKOS_INLINE_FUNCTION void join (value_type& dest, const value_type& src) const {
+    if (src.min_val<dest.min_val) {
+      dest.min_val = src.min_val;
+      dest.min_loc = src.min_loc;
+    }
+    if (src.max_val>dest.max_val) {
+      dest.max_val = src.max_val;
+      dest.max_loc = src.max_loc;
+    }
+    if (src.invalid_loc>dest.invalid_loc) {
+      dest.invalid_loc = src.invalid_loc;
+    }
+  }
+  KOKKOS_INLINE_FUNCTION void init (value_type& val) const {
+    val.min_val = Kokkos::reduction_identity<ST>::min();
+    val.max_val = Kokkos::reduction_identity<ST>::max();
+    val.min_loc = -1;
+    val.max_loc = -1;
+    val.invalid_loc = -1;
+  }
+  KOKKOS_INLINE_FUNCTION value_type& reference () const { return value; }
+  KOKKOS_INLINE_FUNCTION bool references_scalar () const { return true; }
+  KOKKOS_INLINE_FUNCTION result_view_type view () const { return result_view_type(&value); }
+
+  // Update a thread-local value with the field entry v, at flattened index idx
+  KOKKOS_INLINE_FUNCTION
+  static void update (value_type& result, const ST v, const int idx) {
+    if (ekat::is_invalid(v)) {
+      if (idx>result.invalid_loc) {
+        result.invalid_loc = idx;
+      }
+      return;
+    }
+    if (v<result.min_val) {
+      result.min_val = v;
+      result.min_loc = idx;
+    }
+    if (v>result.max_val) {
+      result.max_val = v;
+      result.max_loc = idx;
+    }
+  }
+
+private:
+  value_type& value;
+};
+
+template<typename ST>
+FieldCheckStats compute_field_check_stats_impl (const Field& f)
+{
+  using const_ST    = typename std::add_const<ST>::type;
+  using nonconst_ST = typename std::remove_const<ST>::type;
+  using reducer_t   = FieldCheckStatsReducer<nonconst_ST>;
+  using value_t     = typename reducer_t::value_type;
+
+  const auto& layout = f.get_header().get_identifier().get_layout();
+  const auto extents = layout.extents();
+  const auto size = layout.size();
+
+  value_t stats;
+  switch (layout.rank()) {
+    case 1:
+      {
+        auto v = f.template get_view<const_ST*>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int i, value_t& result) {
+          reducer_t::update(result,v(i),i);
+        }, reducer_t(stats));
+      }
+      break;
+    case 2:
+      {
+        auto v = f.template get_view<const_ST**>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, value_t& result) {
+          int i,j;
+          unflatten_idx(idx,extents,i,j);
+          reducer_t::update(result,v(i,j),idx);
+        }, reducer_t(stats));
+      }
+      break;
+    case 3:
+      {
+        auto v = f.template get_view<const_ST***>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, value_t& result) {
+          int i,j,k;
+          unflatten_idx(idx,extents,i,j,k);
+          reducer_t::update(result,v(i,j,k),idx);
+        }, reducer_t(stats));
+      }
+      break;
+    case 4:
+      {
+        auto v = f.template get_view<const_ST****>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, value_t& result) {
+          int i,j,k,l;
+          unflatten_idx(idx,extents,i,j,k,l);
+          reducer_t::update(result,v(i,j,k,l),idx);
+        }, reducer_t(stats));
+      }
+      break;
+    case 5:
+      {
+        auto v = f.template get_view<const_ST*****>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, value_t& result) {
+          int i,j,k,l,m;
+          unflatten_idx(idx,extents,i,j,k,l,m);
+          reducer_t::update(result,v(i,j,k,l,m),idx);
+        }, reducer_t(stats));
+      }
+      break;
+    case 6:
+      {
+        auto v = f.template get_view<const_ST******>();
+        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, value_t& result) {
+          int i,j,k,l,m,n;
+          unflatten_idx(idx,extents,i,j,k,l,m,n);
+          reducer_t::update(result,v(i,j,k,l,m,n),idx);
+        }, reducer_t(stats));
+      }
+      break;
+    default:
+      EKAT_ERROR_MSG (
+          "Internal error in compute_field_check_stats: unsupported field rank.\n"
+          "You should not have reached this line. Please, contact developers.\n");
+  }
+
+  FieldCheckStats result;
+  result.min_val     = stats.min_val;
+  result.max_val     = stats.max_val;
+  result.min_loc     = stats.min_loc;
+  result.max_loc     = stats.max_loc;
+  result.invalid_loc = stats.invalid_loc;
+  return result;
+}
+
+} // namespace impl
+
+FieldCheckStats compute_field_check_stats (const Field& f)
+{
+  EKAT_REQUIRE_MSG (f.rank()<=6,
+      "Error in compute_field_check_stats: unsupported field rank.\n"
+      "  - Field name: " + f.name() + "\n"
+      "  - Field rank: " + std::to_string(f.rank()) + "\n");
+
+  switch (f.data_type()) {
+    case DataType::IntType:
+      return impl::compute_field_check_stats_impl<int>(f);
+    case DataType::FloatType:
+      return impl::compute_field_check_stats_impl<float>(f);
+    case DataType::DoubleType:
+      return impl::compute_field_check_stats_impl<double>(f);
+    default:
+      EKAT_ERROR_MSG (
+          "Internal error in compute_field_check_stats: unsupported field data type.\n"
+          "You should not have reached this line. Please, contact developers.\n");
+  }
+}
+
+} // namespace scream
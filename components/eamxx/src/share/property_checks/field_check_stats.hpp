@@ -0,0 +1,30 @@
+#ifndef SCREAM_FIELD_CHECK_STATS_HPP
+#define SCREAM_FIELD_CHECK_STATS_HPP
+
+#include "share/field/field.hpp"
+
+namespace scream
+{
+
+// Summary statistics of a field, which are enough to evaluate
+// several pointwise property checks (NaN, lower/upper bounds, interval).
+// All of them are computed in a single pass over the field, so that
+// multiple checks on the same field do not need to traverse it more than once.
+// Locations are flattened indices in the field layout, and are set to -1
+// if no such entry exists (e.g., invalid_loc=-1 if no NaN/Inf was found).
+struct FieldCheckStats {
+  double min_val;
+  double max_val;
+  int    min_loc = -1;
+  int    max_loc = -1;
+  int    invalid_loc = -1;
+};
+
+// Compute the stats above with a single parallel reduction over the field.
+// NaN entries do not participate in min/max, since comparisons with NaN
+// always return false.
+FieldCheckStats compute_field_check_stats (const Field& f);
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_CHECK_STATS_HPP
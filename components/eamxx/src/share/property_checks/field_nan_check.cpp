@@ -2,8 +2,6 @@
 #include "share/field/field_utils.hpp"
 #include "share/util//scream_array_utils.hpp"
 
-#include "ekat/util/ekat_math_utils.hpp"
-
 namespace scream
 {
 
@@ -32,94 +30,12 @@ FieldNaNCheck (const Field& f,
   set_fields ({f},{false});
 }
 
-template<typename ST>
-PropertyCheck::ResultAndMsg FieldNaNCheck::check_impl() const {
-  using const_ST    = typename std::add_const<ST>::type;
-
+PropertyCheck::ResultAndMsg FieldNaNCheck::
+check_from_stats (const FieldCheckStats& stats) const {
   const auto& f = fields().front();
 
   const auto& layout = f.get_header().get_identifier().get_layout();
-  const auto extents = layout.extents();
-  const auto size = layout.size();
-
-  int invalid_idx = -1;
-  using max_t = Kokkos::Max<int>;
-  switch (layout.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<const_ST*>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int i, int& result) {
-          if (ekat::is_invalid(v(i))) {
-            result = i;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<const_ST**>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, int& result) {
-          int i,j;
-          unflatten_idx(idx,extents,i,j);
-          if (ekat::is_invalid(v(i,j))) {
-            result = idx;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<const_ST***>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, int& result) {
-          int i,j,k;
-          unflatten_idx(idx,extents,i,j,k);
-          if (ekat::is_invalid(v(i,j,k))) {
-            result = idx;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<const_ST****>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, int& result) {
-          int i,j,k,l;
-          unflatten_idx(idx,extents,i,j,k,l);
-          if (ekat::is_invalid(v(i,j,k,l))) {
-            result = idx;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<const_ST*****>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, int& result) {
-          int i,j,k,l,m;
-          unflatten_idx(idx,extents,i,j,k,l,m);
-          if (ekat::is_invalid(v(i,j,k,l,m))) {
-            result = idx;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<const_ST******>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, int& result) {
-          int i,j,k,l,m,n;
-          unflatten_idx(idx,extents,i,j,k,l,m,n);
-          if (ekat::is_invalid(v(i,j,k,l,m,n))) {
-            result = idx;
-          }
-        }, max_t(invalid_idx));
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG (
-          "Internal error in FieldNaNCheck: unsupported field rank.\n"
-          "You should not have reached this line. Please, contact developers.\n");
-  }
+  const int invalid_idx = stats.invalid_loc;
 
   PropertyCheck::ResultAndMsg res_and_msg;
   res_and_msg.result = invalid_idx<0 ? CheckResult::Pass : CheckResult::Fail;
@@ -157,20 +73,7 @@ PropertyCheck::ResultAndMsg FieldNaNCheck::check_impl() const {
 }
 
 PropertyCheck::ResultAndMsg FieldNaNCheck::check() const {
-  const auto& f = fields().front();
-
-  switch (f.data_type()) {
-    case DataType::IntType:
-      return check_impl<int>();
-    case DataType::FloatType:
-      return check_impl<float>();
-    case DataType::DoubleType:
-      return check_impl<double>();
-    default:
-      EKAT_ERROR_MSG (
-          "Internal error in FieldNaNCheck: unsupported field data type.\n"
-          "You should not have reached this line. Please, contact developers.\n");
-  }
+  return check_from_stats(compute_field_check_stats(fields().front()));
 }
 
 } // namespace scream
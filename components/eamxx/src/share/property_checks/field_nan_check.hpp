@@ -23,12 +23,9 @@ public:
 
   ResultAndMsg check() const override;
 
-// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
-#ifndef EAMXX_ENABLE_GPU
-protected:
-#endif
-  template<typename ST>
-  ResultAndMsg check_impl() const;
+  // A NaN check only needs to know the location of an invalid entry (if any)
+  bool uses_field_stats () const override { return true; }
+  ResultAndMsg check_from_stats (const FieldCheckStats& stats) const override;
 
 private:
 
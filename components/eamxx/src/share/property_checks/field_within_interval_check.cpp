@@ -75,140 +75,26 @@ std::string FieldWithinIntervalCheck::name () const {
   return ss.str();
 }
 
-template<typename ST>
-PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
+PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::
+check_from_stats (const FieldCheckStats& stats) const
 {
-  using const_ST    = typename std::add_const<ST>::type;
-  using nonconst_ST = typename std::remove_const<ST>::type;
-
   const auto& f = fields().front();
 
   const auto& layout = f.get_header().get_identifier().get_layout();
-  const auto extents = layout.extents();
-  const auto size = layout.size();
 
-  using minmaxloc_t = Kokkos::MinMaxLoc<nonconst_ST,int>;
-  using minmaxloc_value_t = typename minmaxloc_t::value_type;
-  minmaxloc_value_t minmaxloc;
-  switch (layout.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<const_ST*>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int i, minmaxloc_value_t& result) {
-          if (v(i)<result.min_val) {
-            result.min_val = v(i);
-            result.min_loc = i;
-          }
-          if (v(i)>result.max_val) {
-            result.max_val = v(i);
-            result.max_loc = i;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<const_ST**>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, minmaxloc_value_t& result) {
-          int i,j;
-          unflatten_idx(idx,extents,i,j);
-          if (v(i,j)<result.min_val) {
-            result.min_val = v(i,j);
-            result.min_loc = idx;
-          }
-          if (v(i,j)>result.max_val) {
-            result.max_val = v(i,j);
-            result.max_loc = idx;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<const_ST***>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, minmaxloc_value_t& result) {
-          int i,j,k;
-          unflatten_idx(idx,extents,i,j,k);
-          if (v(i,j,k)<result.min_val) {
-            result.min_val = v(i,j,k);
-            result.min_loc = idx;
-          }
-          if (v(i,j,k)>result.max_val) {
-            result.max_val = v(i,j,k);
-            result.max_loc = idx;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<const_ST****>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, minmaxloc_value_t& result) {
-          int i,j,k,l;
-          unflatten_idx(idx,extents,i,j,k,l);
-          if (v(i,j,k,l)<result.min_val) {
-            result.min_val = v(i,j,k,l);
-            result.min_loc = idx;
-          }
-          if (v(i,j,k,l)>result.max_val) {
-            result.max_val = v(i,j,k,l);
-            result.max_loc = idx;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<const_ST*****>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, minmaxloc_value_t& result) {
-          int i,j,k,l,m;
-          unflatten_idx(idx,extents,i,j,k,l,m);
-          if (v(i,j,k,l,m)<result.min_val) {
-            result.min_val = v(i,j,k,l,m);
-            result.min_loc = idx;
-          }
-          if (v(i,j,k,l,m)>result.max_val) {
-            result.max_val = v(i,j,k,l,m);
-            result.max_loc = idx;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<const_ST******>();
-        Kokkos::parallel_reduce(size, KOKKOS_LAMBDA(int idx, minmaxloc_value_t& result) {
-          int i,j,k,l,m,n;
-          unflatten_idx(idx,extents,i,j,k,l,m,n);
-          if (v(i,j,k,l,m,n)<result.min_val) {
-            result.min_val = v(i,j,k,l,m,n);
-            result.min_loc = idx;
-          }
-          if (v(i,j,k,l,m,n)>result.max_val) {
-            result.max_val = v(i,j,k,l,m,n);
-            result.max_loc = idx;
-          }
-        }, minmaxloc_t(minmaxloc));
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG (
-          "Internal error in FieldWithinIntervalCheck: unsupported field rank.\n"
-          "You should not have reached this line. Please, contact developers.\n");
-  }
   PropertyCheck::ResultAndMsg res_and_msg;
 
   bool pass_lower = true, pass_upper = true;
 
-  if (minmaxloc.min_val>=m_lb && minmaxloc.max_val<=m_ub) {
+  if (stats.min_val>=m_lb && stats.max_val<=m_ub) {
     res_and_msg.result = CheckResult::Pass;
-  } else if  (minmaxloc.min_val<m_lb_repairable || minmaxloc.max_val>m_ub_repairable) {
+  } else if  (stats.min_val<m_lb_repairable || stats.max_val>m_ub_repairable) {
     // Check if the min_val fails test
-    if (minmaxloc.min_val<m_lb_repairable) {
+    if (stats.min_val<m_lb_repairable) {
       pass_lower = false;
     }
     // Check if the max_val fails test
-    if (minmaxloc.max_val>m_ub_repairable) {
+    if (stats.max_val>m_ub_repairable) {
       pass_upper = false;
     }
 
@@ -216,11 +102,11 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
   } else {
     res_and_msg.result = CheckResult::Repairable;
     // Check if the min_val fails test
-    if (minmaxloc.min_val<m_lb) {
+    if (stats.min_val<m_lb) {
       pass_lower = false;
     }
     // Check if the max_val fails test
-    if (minmaxloc.max_val>m_ub) {
+    if (stats.max_val>m_ub) {
       pass_upper = false;
     }
   }
@@ -235,8 +121,12 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
     res_and_msg.msg += "  - field id: " + f.get_header().get_identifier().get_id_string() + "\n";
   }
 
-  auto idx_min = unflatten_idx(layout.dims(),minmaxloc.min_loc);
-  auto idx_max = unflatten_idx(layout.dims(),minmaxloc.max_loc);
+  // If the field has no valid entry (e.g., it's all NaN's), there is no min/max location
+  std::vector<int> idx_min, idx_max;
+  if (stats.min_loc>=0) {
+    idx_min = unflatten_idx(layout.dims(),stats.min_loc);
+    idx_max = unflatten_idx(layout.dims(),stats.max_loc);
+  }
 
   if (not pass_lower) {
     res_and_msg.fail_loc_indices = idx_min;
@@ -250,7 +140,7 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
 
   int min_col_lid, max_col_lid;
   bool has_latlon;
-  bool has_col_info = m_grid and layout.tag(0)==COL;
+  bool has_col_info = m_grid and layout.tag(0)==COL and stats.min_loc>=0;
   const Real* lat;
   const Real* lon;
 
@@ -267,7 +157,7 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
 
   std::stringstream msg;
   msg << "  - minimum:\n";
-  msg << "    - value: " << minmaxloc.min_val << "\n";
+  msg << "    - value: " << stats.min_val << "\n";
   if (has_col_info) {
     auto gids = m_grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
     msg << "    - entry: (" << gids(min_col_lid);
@@ -281,7 +171,7 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
   }
 
   msg << "  - maximum:\n";
-  msg << "    - value: " << minmaxloc.max_val << "\n";
+  msg << "    - value: " << stats.max_val << "\n";
   if (has_col_info) {
     auto gids = m_grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
     msg << "    - entry: (" << gids(max_col_lid);
@@ -300,19 +190,7 @@ PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check_impl () const
 }
 
 PropertyCheck::ResultAndMsg FieldWithinIntervalCheck::check() const {
-  const auto& f = fields().front();
-  switch (f.data_type()) {
-    case DataType::IntType:
-      return check_impl<int>();
-    case DataType::FloatType:
-      return check_impl<float>();
-    case DataType::DoubleType:
-      return check_impl<double>();
-    default:
-      EKAT_ERROR_MSG (
-          "Internal error in FieldWithinIntervalCheck: unsupported field data type.\n"
-          "You should not have reached this line. Please, contact developers.\n");
-  }
+  return check_from_stats(compute_field_check_stats(fields().front()));
 }
 
 template<typename ST>
@@ -41,14 +41,15 @@ public:
 
   ResultAndMsg check() const override;
 
+  // An interval check only needs the min/max values of the field (and their location)
+  bool uses_field_stats () const override { return true; }
+  ResultAndMsg check_from_stats (const FieldCheckStats& stats) const override;
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
 #endif
 
-  template<typename ST>
-  ResultAndMsg check_impl () const;
-
   template<typename ST>
   void repair_impl() const;
 
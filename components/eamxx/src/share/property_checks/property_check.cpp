@@ -52,6 +52,12 @@ set_fields (const std::list<Field>& fields,
   }
 }
 
+PropertyCheck::ResultAndMsg PropertyCheck::
+check_from_stats (const FieldCheckStats& /* stats */) const {
+  EKAT_ERROR_MSG ("Error! The method 'check_from_stats' has not been overridden.\n"
+      "  PropertyCheck name: " + name() + "\n");
+}
+
 // If a check fails, attempt to repair things. Default is to throw.
 void PropertyCheck::repair () const {
   EKAT_REQUIRE_MSG (can_repair(),
@@ -1,6 +1,7 @@
 #ifndef SCREAM_PROPERTY_CHECK_HPP
 #define SCREAM_PROPERTY_CHECK_HPP
 
+#include "share/property_checks/field_check_stats.hpp"
 #include "share/field/field.hpp"
 
 #include <ekat/ekat_assert.hpp>
@@ -72,6 +73,13 @@ public:
   // Check if the property is satisfied, and return true if it is
   virtual ResultAndMsg check () const = 0;
 
+  // Pointwise checks on a single field may only need some summary stats of
+  // the field (see field_check_stats.hpp). If so, they can override these two
+  // methods, so that whoever runs the checks can compute the stats once, and
+  // evaluate all checks on the same field with a single pass over its data.
+  virtual bool uses_field_stats () const { return false; }
+  virtual ResultAndMsg check_from_stats (const FieldCheckStats& stats) const;
+
   // Set fields, and whether they can be repaired.
   void set_fields (const std::list<Field>& fields,
                    const std::list<bool>& repairable);
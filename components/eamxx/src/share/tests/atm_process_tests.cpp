@@ -18,6 +18,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 
+#include <functional>
+
 namespace scream {
 
 ekat::ParameterList create_test_params ()
@@ -332,6 +334,57 @@ protected:
   }
 };
 
+// Sets the output field to the sum of the input fields plus an offset
+class Combine : public DummyProcess
+{
+public:
+  Combine (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    if (params.isParameter("Inputs")) {
+      m_inputs = params.get<std::vector<std::string>>("Inputs");
+    }
+    m_output = params.get<std::string>("Output");
+    m_offset = params.get<double>("Offset");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    for (const auto& n : m_inputs) {
+      add_field<Required>(n,lt,K,m_grid_name);
+    }
+    add_field<Computed>(m_output,lt,K,m_grid_name);
+  }
+protected:
+  void run_impl (const double /* dt */) {
+    const auto& f_out = get_field_out(m_output, m_grid_name);
+    auto v_out = f_out.get_view<Real*,Host>();
+    for (int i=0; i<v_out.extent_int(0); ++i) {
+      v_out[i] = m_offset;
+    }
+    for (const auto& n : m_inputs) {
+      const auto& f_in = get_field_in(n, m_grid_name);
+      f_in.sync_to_host();
+      auto v_in = f_in.get_view<const Real*,Host>();
+      for (int i=0; i<v_out.extent_int(0); ++i) {
+        v_out[i] += v_in[i];
+      }
+    }
+    f_out.sync_to_dev();
+  }
+
+  std::vector<std::string> m_inputs;
+  std::string m_output;
+  Real m_offset;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -463,6 +516,17 @@ TEST_CASE("atm_proc_dag", "") {
     dag.write_dag("working_atm_proc_dag.dot",4);
 
     REQUIRE (not dag.has_unmet_dependencies());
+
+    // BarBaz reads what Foo computes, and Baz reads what Bar computes
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_process);
+    auto deps = AtmProcDAG::get_task_dependencies(*group);
+    REQUIRE (deps.size()==2);
+    REQUIRE (deps[0].size()==0);
+    REQUIRE (deps[1]==std::set<int>{0});
+
+    auto subgroup = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(group->get_process(1));
+    auto sub_deps = AtmProcDAG::get_task_dependencies(*subgroup);
+    REQUIRE (sub_deps[1]==std::set<int>{0});
   }
 
   SECTION ("broken") {
@@ -607,6 +671,159 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("parallel_split") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+  factory.register_product("Bar",&create_atmosphere_process<Bar>);
+  factory.register_product("Baz",&create_atmosphere_process<Baz>);
+  factory.register_product("Combine",&create_atmosphere_process<Combine>);
+
+  SECTION ("independent") {
+    // Two procs updating the same field: their increments must be summed
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type","Parallel");
+    params.set<std::string>("atm_procs_list","(AddOne1,AddOne2)");
+    for (std::string n : {"AddOne1","AddOne2"}) {
+      auto& p = params.sublist(n);
+      p.set<std::string>("Type", "AddOne");
+      p.set<std::string>("Grid Name", "Point Grid");
+    }
+
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+    REQUIRE (group->get_schedule_type()==ScheduleType::Parallel);
+    group->set_grids(gm);
+
+    Field f;
+    for(const auto& req : group->get_required_field_requests()) {
+      f = Field(req.fid);
+      f.allocate_view();
+      f.deep_copy(0);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      group->set_required_field(f.get_const());
+      group->set_computed_field(f);
+    }
+
+    group->initialize(t0,RunType::Initial);
+
+    // Each proc sees zero in input, so the group should add two
+    group->run(1);
+    f.sync_to_host();
+    auto v = f.get_view<const Real*,Host>();
+    for (size_t i=0; i<v.size(); ++i) {
+      REQUIRE (v[i]==2);
+    }
+  }
+
+  SECTION ("updater_and_reader") {
+    // AddOne updates Field A, while Reader only reads it: regardless of the
+    // order of the procs, Reader must see the value at the beginning of the step
+    for (std::string order : {"(AddOne,Reader)","(Reader,AddOne)"}) {
+      ekat::ParameterList params ("Atmosphere Processes");
+      params.set<std::string>("schedule_type","Parallel");
+      params.set<std::string>("atm_procs_list",order);
+      auto& p1 = params.sublist("AddOne");
+      p1.set<std::string>("Type", "AddOne");
+      p1.set<std::string>("Grid Name", "Point Grid");
+      auto& p2 = params.sublist("Reader");
+      p2.set<std::string>("Type", "Combine");
+      p2.set<std::string>("Grid Name", "Point Grid");
+      p2.set<std::vector<std::string>>("Inputs",{"Field A"});
+      p2.set<std::string>("Output","Field B");
+      p2.set<double>("Offset",0);
+
+      auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+      group->set_grids(gm);
+
+      std::map<std::string,Field> fields;
+      for (const auto& req : group->get_required_field_requests()) {
+        fields[req.fid.name()] = Field(req.fid);
+      }
+      for (const auto& req : group->get_computed_field_requests()) {
+        if (fields.count(req.fid.name())==0) {
+          fields[req.fid.name()] = Field(req.fid);
+        }
+      }
+      REQUIRE (fields.size()==2);
+      for (auto& it : fields) {
+        it.second.allocate_view();
+        it.second.deep_copy(it.first=="Field A" ? 5 : -1);
+        it.second.get_header().get_tracking().update_time_stamp(t0);
+      }
+      for (const auto& req : group->get_required_field_requests()) {
+        group->set_required_field(fields.at(req.fid.name()).get_const());
+      }
+      for (const auto& req : group->get_computed_field_requests()) {
+        group->set_computed_field(fields.at(req.fid.name()));
+      }
+
+      AtmProcDAG dag;
+      dag.create_dag(*group);
+      REQUIRE (not dag.has_parallel_conflicts());
+
+      group->initialize(t0,RunType::Initial);
+      group->run(1);
+
+      auto& a = fields.at("Field A");
+      auto& b = fields.at("Field B");
+      a.sync_to_host();
+      b.sync_to_host();
+      auto v_a = a.get_view<const Real*,Host>();
+      auto v_b = b.get_view<const Real*,Host>();
+      for (size_t i=0; i<v_a.size(); ++i) {
+        REQUIRE (v_a[i]==6);
+        REQUIRE (v_b[i]==5);
+      }
+    }
+  }
+
+  SECTION ("dependent") {
+    // Baz requires what Bar computes: the procs are not independent
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type","Parallel");
+    params.set<std::string>("atm_procs_list","(Bar,Baz)");
+    for (std::string n : {"Bar","Baz"}) {
+      auto& p = params.sublist(n);
+      p.set<std::string>("Type", n);
+      p.set<std::string>("Grid Name", "Point Grid");
+    }
+
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+    group->set_grids(gm);
+
+    std::map<std::string,Field> fields;
+    for (const auto& req : group->get_required_field_requests()) {
+      fields[req.fid.name()] = Field(req.fid);
+      fields[req.fid.name()].allocate_view();
+      group->set_required_field(fields.at(req.fid.name()).get_const());
+    }
+    for (const auto& req : group->get_computed_field_requests()) {
+      if (fields.count(req.fid.name())==0) {
+        fields[req.fid.name()] = Field(req.fid);
+        fields[req.fid.name()].allocate_view();
+      }
+      group->set_computed_field(fields.at(req.fid.name()));
+    }
+
+    AtmProcDAG dag;
+    dag.create_dag(*group);
+    REQUIRE (dag.has_parallel_conflicts());
+    REQUIRE (dag.parallel_conflicts().count("Baz")==1);
+
+    REQUIRE_THROWS (group->initialize(t0,RunType::Initial));
+  }
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -684,4 +901,118 @@ TEST_CASE ("diagnostics") {
   }
 }
 
+TEST_CASE ("dependency_order") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("Combine",&create_atmosphere_process<Combine>);
+
+  // The procs, in the listed order:
+  //   P1: B = A+1
+  //   P2: C = B+10
+  //   P3: D = A+100
+  //   P4: E = C+D+1000
+  //   P5: A = 7
+  // P3 does not depend on P1, and P5 must wait for both P1 and P3 (which read A),
+  // so the levels are (P1,P3), (P2,P5), (P4), and the execution order
+  // differs from the listed one.
+  using strvec = std::vector<std::string>;
+  auto create_group = [&](const bool dependency_order) {
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type","Sequential");
+    params.set<std::string>("atm_procs_list","(P1,P2,P3,P4,P5)");
+    params.set<bool>("dependency_order",dependency_order);
+    auto set_proc = [&](const std::string& n, const strvec& in,
+                        const std::string& out, const double offset) {
+      auto& p = params.sublist(n);
+      p.set<std::string>("Type", "Combine");
+      p.set<std::string>("Grid Name", "Point Grid");
+      if (in.size()>0) {
+        p.set<strvec>("Inputs",in);
+      }
+      p.set<std::string>("Output",out);
+      p.set<double>("Offset",offset);
+    };
+    set_proc("P1",{"A"},"B",1);
+    set_proc("P2",{"B"},"C",10);
+    set_proc("P3",{"A"},"D",100);
+    set_proc("P4",{"C","D"},"E",1000);
+    set_proc("P5",{},"A",7);
+
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+    group->set_grids(gm);
+    return group;
+  };
+
+  auto run_group = [&](const bool dependency_order) {
+    auto group = create_group(dependency_order);
+    std::map<std::string,Field> fields;
+    for (const auto& req : group->get_required_field_requests()) {
+      fields[req.fid.name()] = Field(req.fid);
+      fields[req.fid.name()].allocate_view();
+    }
+    for (const auto& req : group->get_computed_field_requests()) {
+      if (fields.count(req.fid.name())==0) {
+        fields[req.fid.name()] = Field(req.fid);
+        fields[req.fid.name()].allocate_view();
+      }
+    }
+    REQUIRE (fields.size()==5);
+    for (auto& it : fields) {
+      auto v = it.second.get_view<Real*,Host>();
+      for (int i=0; i<v.extent_int(0); ++i) {
+        v[i] = it.first=="A" ? i : -1;
+      }
+      it.second.sync_to_dev();
+      it.second.get_header().get_tracking().update_time_stamp(t0);
+    }
+    for (const auto& req : group->get_required_field_requests()) {
+      group->set_required_field(fields.at(req.fid.name()).get_const());
+    }
+    for (const auto& req : group->get_computed_field_requests()) {
+      group->set_computed_field(fields.at(req.fid.name()));
+    }
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+    group->finalize();
+    for (auto& it : fields) {
+      it.second.sync_to_host();
+    }
+    return fields;
+  };
+
+  auto seq = run_group(false);
+  auto df  = run_group(true);
+  for (const auto& it : seq) {
+    auto v_seq = it.second.get_view<const Real*,Host>();
+    auto v_df  = df.at(it.first).get_view<const Real*,Host>();
+    REQUIRE (v_seq.size()==v_df.size());
+    for (size_t i=0; i<v_seq.size(); ++i) {
+      REQUIRE (v_df[i]==v_seq[i]);
+    }
+  }
+
+  auto check = [&](const std::string& name, const std::function<Real(int)>& expected) {
+    auto v = df.at(name).get_view<const Real*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      REQUIRE (v[i]==expected(i));
+    }
+  };
+  check("A",[](int)   { return 7; });
+  check("B",[](int i) { return i+1; });
+  check("C",[](int i) { return i+11; });
+  check("D",[](int i) { return i+100; });
+  check("E",[](int i) { return 2*i+1111; });
+}
+
 } // empty namespace
@@ -6,6 +6,7 @@
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_array_utils.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
 
@@ -261,6 +262,55 @@ TEST_CASE("property_checks", "") {
     }
   }
 
+  // Check that checks on the same field can share a single stats computation
+  SECTION ("field_check_stats") {
+    auto nan_check = std::make_shared<FieldNaNCheck>(f,grid);
+    auto interval_check = std::make_shared<FieldWithinIntervalCheck>(f, grid, 0, 1);
+    auto lb_check = std::make_shared<FieldLowerBoundCheck>(f, grid, 0);
+    REQUIRE (nan_check->uses_field_stats());
+    REQUIRE (interval_check->uses_field_stats());
+    REQUIRE (lb_check->uses_field_stats());
+
+    f.deep_copy(0.5);
+    auto f_view = f.get_view<Real***,Host>();
+    f_view(0,1,2) = -1.0;
+    f_view(1,0,4) = 3.0;
+    f_view(1,2,3) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+
+    // NaN entries do not contribute to min/max
+    const auto& layout = f.get_header().get_identifier().get_layout();
+    auto stats = compute_field_check_stats(f);
+    REQUIRE (stats.min_val==-1.0);
+    REQUIRE (stats.max_val==3.0);
+    std::vector<int> exp_min_loc = {0,1,2};
+    REQUIRE (unflatten_idx(layout.dims(),stats.min_loc)==exp_min_loc);
+    std::vector<int> exp_max_loc = {1,0,4};
+    REQUIRE (unflatten_idx(layout.dims(),stats.max_loc)==exp_max_loc);
+    std::vector<int> exp_invalid_loc = {1,2,3};
+    REQUIRE (unflatten_idx(layout.dims(),stats.invalid_loc)==exp_invalid_loc);
+
+    // Checks evaluated from shared stats must match the standalone ones
+    for (auto pc : std::vector<std::shared_ptr<PropertyCheck>>{nan_check,interval_check,lb_check}) {
+      auto res_shared = pc->check_from_stats(stats);
+      auto res = pc->check();
+      REQUIRE (res_shared.result==CheckResult::Fail);
+      REQUIRE (res_shared.result==res.result);
+      REQUIRE (res_shared.msg==res.msg);
+      REQUIRE (res_shared.fail_loc_indices==res.fail_loc_indices);
+    }
+
+    // Remove the NaN and the negative value: now only the upper bound fails
+    f_view(0,1,2) = 0.5;
+    f_view(1,2,3) = 0.5;
+    f.sync_to_dev();
+    stats = compute_field_check_stats(f);
+    REQUIRE (stats.invalid_loc==-1);
+    REQUIRE (nan_check->check_from_stats(stats).result==CheckResult::Pass);
+    REQUIRE (lb_check->check_from_stats(stats).result==CheckResult::Pass);
+    REQUIRE (interval_check->check_from_stats(stats).result==CheckResult::Fail);
+  }
+
   // Check that the values of a field are above below an upper bound
   SECTION ("field_upper_bound_check") {
     auto upper_bound_check = std::make_shared<FieldUpperBoundCheck>(f,grid,1.0, true);
@@ -0,0 +1,34 @@
+#define CATCH_CONFIG_RUNNER
+
+#include <catch2/catch.hpp>
+
+#include <mpi.h>
+
+#include <cstdio>
+
+// Defined in scream_test_session.cpp
+void ekat_initialize_test_session (int argc, char** argv, const bool print_config);
+void ekat_finalize_test_session ();
+
+// Same as the default test main, except that MPI is initialized with
+// MPI_THREAD_MULTIPLE support, which the scorpio I/O thread requires.
+// Tests using it must be created with the EXCLUDE_MAIN_CPP option.
+int main (int argc, char** argv) {
+
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+  if (provided<MPI_THREAD_MULTIPLE) {
+    printf("Error! The MPI library does not support MPI_THREAD_MULTIPLE.\n");
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  ekat_initialize_test_session(argc,argv,true);
+
+  int result = Catch::Session().run(argc,argv);
+
+  ekat_finalize_test_session();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -3,6 +3,7 @@
 #include <pybind11/pybind11.h>
 
 #include <catch2/catch.hpp>
+#include <fstream>
 #include <iomanip>
 
 #include "control/atmosphere_driver.hpp"
@@ -32,6 +33,38 @@ TEST_CASE("ml_correction-stand-alone", "") {
 
   ekat::Comm atm_comm(MPI_COMM_WORLD);
 
+  // Write a small network for MLCorrection: the first layer computes the
+  // column mean of qv (and its opposite, zeroed by the relu), and the second
+  // one maps it to tend(k) = (k+1)/nlevs*mean(qv) + bias.
+  const auto &ml_params = ad_params.sublist("atmosphere_processes").sublist("MLCorrection");
+  const auto  nn_file   = ml_params.get<std::string>("ml_model_path");
+  const int   nn_levs   = ad_params.sublist("grids_manager")
+                            .sublist("Physics")
+                            .get<int>("number_of_vertical_levels");
+  const Real  nn_bias   = 1e-3;
+  if(atm_comm.am_i_root()) {
+    std::ofstream nn(nn_file);
+    nn << std::setprecision(17);
+    nn << "MLCORRECTION_NN " << MLCorrectionNN::format_version << "\n2\n";
+    nn << nn_levs << " 2 relu\n";
+    for(int i = 0; i < 2; ++i) {
+      for(int k = 0; k < nn_levs; ++k) {
+        nn << (i == 0 ? 1.0 : -1.0) / nn_levs << " ";
+      }
+      nn << "\n";
+    }
+    nn << "0 0\n";
+    nn << "2 " << nn_levs << " linear\n";
+    for(int k = 0; k < nn_levs; ++k) {
+      nn << (k + 1.0) / nn_levs << " " << -1.0 << "\n";
+    }
+    for(int k = 0; k < nn_levs; ++k) {
+      nn << nn_bias << " ";
+    }
+    nn << "\n";
+  }
+  atm_comm.barrier();
+
   auto &proc_factory = AtmosphereProcessFactory::instance();
   auto &gm_factory   = GridsManagerFactory::instance();
   proc_factory.register_product("MLCorrection",
@@ -77,6 +110,25 @@ TEST_CASE("ml_correction-stand-alone", "") {
   ekat::enable_fpes(fpe_mask);
   REQUIRE(qv(1, 10) == reference);   // This is the one that is modified
   REQUIRE(qv(1, 30) != reference2);  // This one should be unchanged
+
+  // Check the tendency computed by the network against the expected one
+  qv_field.sync_to_dev();
+  for(int i = 0; i < nsteps; ++i) {
+    ad.run(dt);
+  }
+  const auto &tend_field = field_mgr.get_field("qv_nudging_tend");
+  tend_field.sync_to_host();
+  const auto &tend = tend_field.get_view<const Real **, Host>();
+  for(int icol = 0; icol < num_cols; ++icol) {
+    Real mean = 0;
+    for(int jlev = 0; jlev < num_levs; ++jlev) {
+      mean += qv(icol, jlev) / num_levs;
+    }
+    for(int jlev = 0; jlev < num_levs; ++jlev) {
+      const Real expected = (jlev + 1.0) / num_levs * mean + nn_bias;
+      REQUIRE(std::abs(tend(icol, jlev) - expected) <= 1e-5 * std::abs(expected));
+    }
+  }
   ad.finalize();
 }
 }  // namespace scream
@@ -43,6 +43,7 @@ CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
   finished_setup_ = false;
+  reduce_pending_ = false;
   cedr_throw_if(nlclcells == 0, "CAAS does not support 0 cells on a rank.");
   tracer_decls_ = std::make_shared<std::vector<Decl> >();  
 }
@@ -200,14 +201,6 @@ void CAAS<ES>::reduce_locally () {
   }
 }
 
-template <typename ES>
-void CAAS<ES>::reduce_globally () {
-  const int err = mpi::all_reduce(*p_, send_.data(), recv_.data(),
-                                  send_.size(), MPI_SUM);
-  cedr_throw_if(err != MPI_SUCCESS,
-                "CAAS::reduce_globally MPI_Allreduce returned " << err);
-}
-
 template <typename ES>
 void CAAS<ES>::finish_locally () {
   using ESU = cedr::impl::ExeSpaceUtils<ES>;
@@ -257,15 +250,38 @@ const typename CAAS<ES>::DeviceOp& CAAS<ES>::get_device_op() { return o; }
 
 template <typename ES>
 void CAAS<ES>::run () {
+  start_reduce();
+  finish_reduce();
+}
+
+template <typename ES>
+void CAAS<ES>::start_reduce () {
   cedr_assert(finished_setup_);
+  cedr_assert( ! reduce_pending_);
   reduce_locally();
   const bool user_reduces = user_reducer_ != nullptr;
-  if (user_reduces)
+  if (user_reduces) {
     (*user_reducer_)(*p_, send_.data(), recv_.data(),
                      o.nlclcells_ / user_reducer_->n_accum_in_place(),
                      recv_.size(), MPI_SUM);
-  else
-    reduce_globally();
+  } else {
+    // MPI reads send_ asynchronously, so reduce_locally must be done.
+    Kokkos::fence();
+    const int err = mpi::iall_reduce(*p_, send_.data(), recv_.data(),
+                                     send_.size(), MPI_SUM, &reduce_req_);
+    cedr_throw_if(err != MPI_SUCCESS,
+                  "CAAS::start_reduce MPI_Iallreduce returned " << err);
+    reduce_pending_ = true;
+  }
+}
+
+template <typename ES>
+void CAAS<ES>::finish_reduce () {
+  cedr_assert(finished_setup_);
+  if (reduce_pending_) {
+    mpi::waitall(1, &reduce_req_);
+    reduce_pending_ = false;
+  }
   finish_locally();
 }
 
@@ -302,9 +318,10 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
+            const bool split_reduce, const bool verbose)
     : TestRandomized("CAAS", p, ncells, verbose),
-      p_(p), external_memory_(external_memory)
+      p_(p), external_memory_(external_memory), split_reduce_(split_reduce),
+      nerr_local_work_(0)
   {
     const auto np = p->size(), rank = p->rank();
     nlclcells_ = ncells / np;
@@ -360,15 +377,47 @@ struct TestCAAS : public cedr::test::TestRandomized {
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    if (split_reduce_) {
+      caas_->start_reduce();
+      // Do local work while the global reduction is in flight. The CAAS
+      // result is checked by TestRandomized, and the local work here.
+      run_local_work();
+      caas_->finish_reduce();
+      nerr_local_work_ += check_local_work();
+    } else {
+      caas_->run();
+    }
   }
 
+  Int get_local_work_nerr () const { return nerr_local_work_; }
+
 private:
   mpi::Parallel::Ptr p_;
-  bool external_memory_;
-  Int nlclcells_;
+  bool external_memory_, split_reduce_;
+  Int nlclcells_, nerr_local_work_;
   CAAST::Ptr caas_;
-  typename CAAST::RealList buf1_, buf2_;
+  typename CAAST::RealList buf1_, buf2_, work_;
+
+  // Work that does not depend on the reduction: fill work_ with the first
+  // nlclcells_ odd numbers.
+  void run_local_work () {
+    work_ = typename CAAST::RealList("work", nlclcells_);
+    const auto work = work_;
+    const auto f = KOKKOS_LAMBDA (const Int& i) { work(i) = 2*i + 1; };
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, nlclcells_), f);
+  }
+
+  // The sum of the first n odd numbers is n^2.
+  Int check_local_work () const {
+    const auto work = work_;
+    Real sum = 0;
+    const auto f = KOKKOS_LAMBDA (const Int& i, Real& s) { s += work(i); };
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, nlclcells_), f, sum);
+    if (sum == Real(nlclcells_)*nlclcells_) return 0;
+    pr("CAAS local work between start_reduce and finish_reduce: sum " << sum
+       << " != " << Real(nlclcells_)*nlclcells_);
+    return 1;
+  }
 
   static Int get_nllclcells (const Int& ncells, const Int& np, const Int& rank) {
     Int nlclcells = ncells / np;
@@ -385,9 +434,15 @@ Int unittest (const mpi::Parallel::Ptr& p) {
     Long ncells = np*nlclcells;
     if (ncells > np) ncells -= np/2;
     for (const bool own_reducer : {false, true})
-      for (const bool external_memory : {false, true})
-        nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
+      for (const bool external_memory : {false, true}) {
+        nerr += TestCAAS(p, ncells, own_reducer, external_memory, false, false)
           .run<TestCAAS::CAAST>(1, false);
+        if ( ! own_reducer) {
+          TestCAAS t(p, ncells, own_reducer, external_memory, true, false);
+          nerr += t.run<TestCAAS::CAAST>(1, false);
+          nerr += t.get_local_work_nerr();
+        }
+      }
   }
   return nerr;
 }
@@ -88,6 +88,14 @@ public:
 
   void run() override;
 
+  // Split-phase run, so the caller can do independent work while the global
+  // reduction is in flight. start_reduce does the local reduction and starts
+  // the global one; finish_reduce waits for it, then adjusts the cell
+  // values. run() is the same as start_reduce(); finish_reduce(). With a
+  // UserAllReducer, the global reduction completes in start_reduce.
+  void start_reduce();
+  void finish_reduce();
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -106,8 +114,8 @@ protected:
   RealList send_, recv_;
   bool finished_setup_;
   DeviceOp o;
-
-  void reduce_globally();
+  mpi::Request reduce_req_;
+  bool reduce_pending_;
 
 PRIVATE_CUDA:
   void reduce_locally();
@@ -114,6 +114,8 @@ void finalize_init_phase (IslMpi<MT>& cm, typename IslMpi<MT>::Advecter& advecte
   if (cm.halo == 2)
     extend_halo::extend_local_meshes<MT>(*cm.p, cm.ed_h, advecter);
   advecter.fill_nearest_points_if_needed();
+  // After fill_nearest_points_if_needed, since it makes planar meshes continuous.
+  advecter.fill_nbrs();
   advecter.sync_to_device();
   sync_to_device(cm);
 }
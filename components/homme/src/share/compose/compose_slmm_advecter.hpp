@@ -176,6 +176,9 @@ struct Advecter {
 
   void fill_nearest_points_if_needed();
 
+  // Build the cell adjacency get_src_cell uses to walk to the source cell.
+  void fill_nbrs();
+
   // After Advecter is fully initialized, send all the data to device.
   void sync_to_device();
 
@@ -288,6 +291,12 @@ void Advecter<MT>
   }
 }
 
+template <typename MT>
+void Advecter<MT>::fill_nbrs () {
+  for (Int ie = 0; ie < local_mesh_h_.extent_int(0); ++ie)
+    slmm::fill_nbrs(local_mesh_h_(ie));
+}
+
 template <typename MT>
 void Advecter<MT>::fill_nearest_points_if_needed () {
   if (geometry_ == Geometry::Type::plane) {
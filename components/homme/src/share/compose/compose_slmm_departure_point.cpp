@@ -68,6 +68,42 @@ void make_continuous (const Plane& p, LocalMesh<ko::MachineTraits::HES>& m) {
   }
 }
 
+void fill_nbrs (LocalMesh<ko::MachineTraits::HES>& m) {
+  using nearest_point::calc_dist;
+  const Int ncell = nslices(m.e);
+  // Get the minimum edge length to normalize distance.
+  Real min_edge_len = 10;
+  for (Int ic = 0; ic < ncell; ++ic) {
+    const auto cell = slice(m.e, ic);
+    for (Int ie = 0; ie < 4; ++ie)
+      min_edge_len = std::min(min_edge_len,
+                              calc_dist(m, cell[ie], cell[(ie+1)%4]));
+  }
+  m.nbr = LocalMesh<ko::MachineTraits::HES>::IntArray("nbr", ncell, 4);
+  ko::deep_copy(m.nbr, -1);
+  // Edges are oriented CCW, so a shared edge is traversed in opposite
+  // directions by the two cells.
+  for (Int ic0 = 0; ic0 < ncell; ++ic0) {
+    const auto cell0 = slice(m.e, ic0);
+    for (Int ie0 = 0; ie0 < 4; ++ie0) {
+      for (Int ic1 = 0; ic1 < ncell; ++ic1) {
+        if (ic1 == ic0) continue;
+        const auto cell1 = slice(m.e, ic1);
+        Int ie1 = 0;
+        for ( ; ie1 < 4; ++ie1) {
+          const auto edist = (calc_dist(m, cell0[ie0], cell1[(ie1+1)%4]) +
+                              calc_dist(m, cell0[(ie0+1)%4], cell1[ie1]));
+          if (edist < 0.01*min_edge_len) break;
+        }
+        if (ie1 < 4) {
+          m.nbr(ic0,ie0) = ic1;
+          break;
+        }
+      }
+    }
+  }
+}
+
 namespace nearest_point {
 
 Int test_canpoa (const bool sphere) {
@@ -178,6 +214,38 @@ Int unittest (LocalMesh<ko::MachineTraits::HES>& m, const Int tgt_elem,
   }
   if (ne) pr("slmm::unittest: get_src_cell failed");
   nerr += ne;
+  {
+    // The walk must find the same cells as the full search, including for
+    // points on edges and corners shared by several cells. Remove the cell
+    // adjacency from a (shallow) copy of the mesh to get the full search.
+    auto m_search = m;
+    m_search.nbr = decltype(m.nbr)();
+    fill_nbrs(m);
+    ne = 0;
+    const Real atol_tie = calc_pad_atol(m, tgt_elem);
+    for (Int ic = 0; ic < nc; ++ic) {
+      const auto cell = slice(m.e, ic);
+      static const Real alphas[] = { 0.5, 0.01, 0.99, 0, 1 };
+      static const int nalphas = sizeof(alphas)/sizeof(*alphas);
+      for (Int i = 0; i < nalphas; ++i)
+        for (Int j = 0; j < nalphas; ++j) {
+          const Real a = alphas[i], oma = 1-a, b = alphas[j], omb = 1-b;
+          Real v[3] = {0};
+          for (Int d = 0; d < 3; ++d)
+            v[d] = (  b*(a*m.p(cell[0], d) + oma*m.p(cell[1], d)) +
+                    omb*(a*m.p(cell[3], d) + oma*m.p(cell[2], d)));
+          if (m.is_sphere()) siqk::SphereGeometry::normalize(v);
+          const Int ic_search = get_src_cell(m_search, v, tgt_elem);
+          if (get_src_cell(m, v, tgt_elem) != ic_search) ++ne;
+          const Int ic_walk = walk_to_src_cell(m, v, tgt_elem, atol_tie);
+          if (ic_walk != -1 && ic_walk != ic_search) ++ne;
+          // Cell centers are not near any edge, so the walk must find them.
+          if (i == 0 && j == 0 && ic_walk != ic) ++ne;
+        }
+    }
+    if (ne) pr("slmm::unittest: walk_to_src_cell failed");
+    nerr += ne;
+  }
   ne = nearest_point::test_canpoa(true);
   if (ne) pr("slmm::unittest: test_canpoa sphere failed");
   nerr += ne;
@@ -38,6 +38,11 @@ struct LocalMesh {
   // mesh.nml(perimnml(k),:) is the k'th edge's normal.
   Ints perimp, perimnml;
 
+  // If allocated (see fill_nbrs), nbr(ic,ie) is the cell across edge ie of cell
+  // ic, or -1 if this edge is on the perimeter. get_src_cell uses it to walk
+  // from the target cell to the source cell rather than search all cells.
+  IntArray nbr;
+
   // Index of the target element in this local mesh.
   Int tgt_elem;
 
@@ -82,6 +87,10 @@ void fill_normals(LocalMesh<ko::MachineTraits::HES>& m);
 // continuous in space, anchored at m.tgt_elem.
 void make_continuous(const Plane& p, LocalMesh<ko::MachineTraits::HES>& m);
 
+// Fill m.nbr. Cells do not share vertex indices, so edges are matched by
+// distance. For a planar mesh, call this after make_continuous.
+void fill_nbrs(LocalMesh<ko::MachineTraits::HES>& m);
+
 template <typename ESD, typename ESS>
 void deep_copy (LocalMesh<ESD>& d, const LocalMesh<ESS>& s) {
   siqk::resize_and_copy(d.p, s.p);
@@ -91,6 +100,7 @@ void deep_copy (LocalMesh<ESD>& d, const LocalMesh<ESS>& s) {
   d.tgt_elem = s.tgt_elem;
   siqk::resize_and_copy(d.perimp, s.perimp);
   siqk::resize_and_copy(d.perimnml, s.perimnml);
+  siqk::resize_and_copy(d.nbr, s.nbr);
 }
 
 // Is v inside, including on, the quad ic?
@@ -117,6 +127,62 @@ bool is_inside (const LocalMesh<ES>& m,
   return inside;
 }
 
+// Tolerance by which to pad the cells in the search for the cell containing a
+// point. Recall we're operating on the unit sphere, so we don't have to worry
+// about a radius in the following.
+template <typename ES> SLMM_KIF
+Real calc_pad_atol (const LocalMesh<ES>& m, const Int& ic) {
+  using slmm::slice;
+  //   Get a representative edge length.
+  const auto cell = slice(m.e, ic);
+  Real d[3];
+  siqk::SphereGeometry::axpbyz( 1, slice(m.p, cell[1]),
+                               -1, slice(m.p, cell[0]),
+                               d);
+  const Real L = std::sqrt(siqk::SphereGeometry::norm2(d));
+  // We can expect to lose approx. -log10(L) digits due to cancellation in the
+  // formation of the edge normal and in dot_c_amb. Multiply by 100 for a little
+  // extra padding.
+  return 1e2 * ko::NumericTraits<Real>::epsilon() / L;
+}
+
+// Walk from cell my_ic toward v, each time crossing the edge v is farthest
+// outside of, until reaching the cell containing v. Return -1 if the walk
+// leaves the local mesh or does not terminate, in which case the caller must
+// fall back to the full search. The result is the same as the full search with
+// atol = 0, which picks my_ic if it contains v and otherwise the lowest-index
+// cell containing v. A point within atol_tie of the boundary of a cell other
+// than my_ic may be contained in several cells, so in that case -1 is returned
+// as well, and the full search breaks the tie.
+template <typename ES> SLMM_KIF
+int walk_to_src_cell (const LocalMesh<ES>& m, const Real* v, const Int& my_ic,
+                      const Real& atol_tie) {
+  using slmm::slice;
+  const Int nc = len(m.e);
+  Int ic = my_ic;
+  for (Int step = 0; step < nc; ++step) {
+    const auto cell = slice(m.e, ic);
+    const auto celln = slice(m.en, ic);
+    Int ie_min = -1;
+    Real min_dot = 0;
+    for (Int ie = 0; ie < 4; ++ie) {
+      const Real dot = siqk::SphereGeometry::dot_c_amb(slice(m.nml, celln[ie]),
+                                                       v, slice(m.p, cell[ie]));
+      if (ie_min == -1 || dot < min_dot) {
+        min_dot = dot;
+        ie_min = ie;
+      }
+    }
+    if (min_dot >= 0) {
+      if (ic != my_ic && min_dot <= atol_tie) return -1;
+      return ic;
+    }
+    ic = m.nbr(ic, ie_min);
+    if (ic == -1) return -1;
+  }
+  return -1;
+}
+
 // Both cubed_sphere_map=0 and cubed_sphere_map=2 can use this method.
 // (cubed_sphere_map=1 is not impl'ed in Homme.)
 //   This method is natural for cubed_sphere_map=2, so RRM works automatically.
@@ -133,26 +199,18 @@ int get_src_cell (const LocalMesh<ES>& m, // Local mesh.
                   const Int my_ic = -1) { // Target cell in the local mesh.
   using slmm::len;
   const Int nc = len(m.e);
+  // Usually the source cell is the target cell or near it, so first try to
+  // walk there.
+  if (my_ic != -1 && m.nbr.size() > 0) {
+    const Int ic = walk_to_src_cell(m, v, my_ic, calc_pad_atol(m, my_ic));
+    if (ic != -1) return ic;
+  }
   Real atol = 0;
   for (Int trial = 0; trial < 3; ++trial) {
     if (trial > 0) {
       if (trial == 1) {
-        using slmm::slice;
-        // If !inside in the first sweep, pad each cell. Recall we're operating
-        // on the unit sphere, so we don't have to worry about a radius in the
-        // following.
-        //   Get a representative edge length.
-        const int ic = my_ic == -1 ? 0 : my_ic;
-        const auto cell = slice(m.e, ic);
-        Real d[3];
-        siqk::SphereGeometry::axpbyz( 1, slice(m.p, cell[1]),
-                                     -1, slice(m.p, cell[0]),
-                                     d);
-        const Real L = std::sqrt(siqk::SphereGeometry::norm2(d));
-        // We can expect to lose approx. -log10(L) digits due to cancellation in
-        // the formation of the edge normal and in dot_c_amb. Multiply by 100
-        // for a little extra padding.
-        atol = 1e2 * ko::NumericTraits<Real>::epsilon() / L;
+        // If !inside in the first sweep, pad each cell.
+        atol = calc_pad_atol(m, my_ic == -1 ? 0 : my_ic);
       } else {
         // Ok, we really didn't do that very well. We're still failing to find
         // the element. Ramp up the atol even more.
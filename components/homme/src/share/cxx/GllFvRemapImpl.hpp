@@ -161,15 +161,64 @@ struct GllFvRemapImpl {
     assert(y.extent_int(0) >= m && y.extent_int(1) >= nlev);
     using Kokkos::parallel_for;
     const auto ttrn = Kokkos::TeamThreadRange(team, n);
-    const auto ttrm = Kokkos::TeamThreadRange(team, m);
     const auto tvr = Kokkos::ThreadVectorRange(team, nlev);
     loop_ik(ttrn, tvr, [&] (int i, int k) { w(i,k) = x(i,k) * d1(i); });
     team.team_barrier();
-    parallel_for( ttrm,   [&] (const int i) {
-      parallel_for(tvr,   [&] (const int k) { y(i,k) = 0; });
-      for (int j = 0; j < n; ++j)
-        parallel_for(tvr, [&] (const int k) { y(i,k) += A(i,j) * w(j,k); });
-      parallel_for(tvr,   [&] (const int k) { y(i,k) /= s2 * d2(i); }); });
+    small_gemm(team, m, n, nlev,
+               [&] (const int i, const int j) { return A(i,j); },
+               [&] (const int, const int j, const int k) { return w(j,k); },
+               [&] (const int i, const int k, const typename YT::non_const_value_type& yik) {
+                 y(i,k) = yik / (s2 * d2(i)); });
+  }
+
+  enum : int { gemm_nlev_blk = 4 };
+
+  /* Compute (0-based indexing)
+         y(i,k) = sum_{j=0:n-1} a(i,j) x(i,j,k), i = 0:m-1, k = 0:nlev-1,
+     i.e., a small GEMM whose SIMD dimension is the level pack. a, x, and y are
+     functors, so that callers can express transposed or interleaved operands
+     and apply a scaling on output; x gets the row i for the same reason.
+         a(i,j) -> Real
+         x(i,j,k) -> value
+         y(i,k,value)
+     On GPU, each thread accumulates one (i,k). On CPU, where a team has one
+     thread, levels are processed in blocks of gemm_nlev_blk packs accumulated
+     in registers, so each a(i,j) is loaded once per block rather than once per
+     level, and y is stored once rather than updated n times. The sum is taken
+     in the same order in both cases.
+   */
+  template <typename AF, typename XF, typename YF>
+  static KOKKOS_INLINE_FUNCTION void
+  small_gemm (const MT& team, const int m, const int n, const int nlev,
+              const AF& a, const XF& x, const YF& y) {
+    using Kokkos::parallel_for;
+    using V = typename std::decay<decltype(x(0,0,0))>::type;
+    const auto ttrm = Kokkos::TeamThreadRange(team, m);
+    if (OnGpu<ExecSpace>::value || team.team_size() > 1) {
+      loop_ik(ttrm, Kokkos::ThreadVectorRange(team, nlev), [&] (int i, int k) {
+        V acc(0);
+        for (int j = 0; j < n; ++j) acc += a(i,j) * x(i,j,k);
+        y(i,k,acc);
+      });
+      return;
+    }
+    parallel_for(ttrm, [&] (const int i) {
+      int k = 0;
+      for ( ; k + gemm_nlev_blk <= nlev; k += gemm_nlev_blk) {
+        V acc[gemm_nlev_blk];
+        for (int b = 0; b < gemm_nlev_blk; ++b) acc[b] = V(0);
+        for (int j = 0; j < n; ++j) {
+          const Real aij = a(i,j);
+          for (int b = 0; b < gemm_nlev_blk; ++b) acc[b] += aij * x(i,j,k+b);
+        }
+        for (int b = 0; b < gemm_nlev_blk; ++b) y(i,k+b,acc[b]);
+      }
+      for ( ; k < nlev; ++k) {
+        V acc(0);
+        for (int j = 0; j < n; ++j) acc += a(i,j) * x(i,j,k);
+        y(i,k,acc);
+      }
+    });
   }
 
   // Handle (dof,d) vs (d,dof) index ordering.
@@ -204,7 +253,6 @@ struct GllFvRemapImpl {
     using Kokkos::parallel_for;
     const auto ttrn  = Kokkos::TeamThreadRange(team,   n);
     const auto ttrm  = Kokkos::TeamThreadRange(team,   m);
-    const auto ttr2m = Kokkos::TeamThreadRange(team, 2*m);
     const auto tvr = Kokkos::ThreadVectorRange(team, nlev);
     parallel_for(ttrn, [&] (const int i) {
       // This impl permits w to alias x. The alternative is to use twice as many
@@ -218,17 +266,19 @@ struct GllFvRemapImpl {
       });
     });
     team.team_barrier();
-    parallel_for(ttr2m, [&] (const int idx) {
-      const int i = remapd_idx_dof<!x_idx_dof_d>(m, idx);
-      const int d = remapd_idx_d  <!x_idx_dof_d>(m, idx);
-      int yi1, yi2; remapd_idx_order<!x_idx_dof_d>(i, d, yi1, yi2);
-      parallel_for(tvr, [&] (const int k) { y(yi1,yi2,k) = 0; });
-      for (int j = 0; j < n; ++j) {
-        int xj1, xj2; remapd_idx_order<x_idx_dof_d>(j, d, xj1, xj2);
-        parallel_for(tvr, [&] (const int k) { y(yi1,yi2,k) += A(i,j) * w(xj1,xj2,k); });
-      }
-      parallel_for(tvr, [&] (const int k) { y(yi1,yi2,k) /= s2; });
-    });
+    // Rows idx of the GEMM interleave (i,d) in y's order.
+    small_gemm(team, 2*m, n, nlev,
+               [&] (const int idx, const int j) {
+                 return A(remapd_idx_dof<!x_idx_dof_d>(m, idx), j); },
+               [&] (const int idx, const int j, const int k) {
+                 const int d = remapd_idx_d<!x_idx_dof_d>(m, idx);
+                 int xj1, xj2; remapd_idx_order<x_idx_dof_d>(j, d, xj1, xj2);
+                 return w(xj1,xj2,k); },
+               [&] (const int idx, const int k, const typename WT::non_const_value_type& yik) {
+                 const int i = remapd_idx_dof<!x_idx_dof_d>(m, idx);
+                 const int d = remapd_idx_d  <!x_idx_dof_d>(m, idx);
+                 int yi1, yi2; remapd_idx_order<!x_idx_dof_d>(i, d, yi1, yi2);
+                 y(yi1,yi2,k) = yik / s2; });
     team.team_barrier();
     parallel_for(ttrm, [&] (const int i) {
       // This impl avoids a work slot having y's structure; the alternative
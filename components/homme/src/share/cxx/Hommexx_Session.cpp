@@ -51,6 +51,26 @@ void print_homme_config_settings () {
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: on\n";
 #else
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: off\n";
+#endif
+#ifdef HOMMEXX_CAAR_OVERLAP_EXCHANGE
+    std::cout << "HOMMEXX CAAR_OVERLAP_EXCHANGE: on\n";
+#else
+    std::cout << "HOMMEXX CAAR_OVERLAP_EXCHANGE: off\n";
+#endif
+#ifdef HOMMEXX_HV_SINGLE_PRECISION_EXCHANGE
+    std::cout << "HOMMEXX HV_SINGLE_PRECISION_EXCHANGE: on\n";
+#else
+    std::cout << "HOMMEXX HV_SINGLE_PRECISION_EXCHANGE: off\n";
+#endif
+#ifdef HOMMEXX_DIRK_MODIFIED_NEWTON
+    std::cout << "HOMMEXX DIRK_MODIFIED_NEWTON: on\n";
+#else
+    std::cout << "HOMMEXX DIRK_MODIFIED_NEWTON: off\n";
+#endif
+#ifdef HOMMEXX_HV_OVERLAP_EXCHANGE
+    std::cout << "HOMMEXX HV_OVERLAP_EXCHANGE: on\n";
+#else
+    std::cout << "HOMMEXX HV_OVERLAP_EXCHANGE: off\n";
 #endif
     std::cout << "HOMMEXX CUDA_(MIN/MAX)_WARP_PER_TEAM: " << HOMMEXX_CUDA_MIN_WARP_PER_TEAM
               << " / " << HOMMEXX_CUDA_MAX_WARP_PER_TEAM << "\n";
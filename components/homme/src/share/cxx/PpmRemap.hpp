@@ -67,6 +67,10 @@ static constexpr int DMA_LEV = DMA_PHYSICAL_LEV / VECTOR_SIZE;
 static constexpr int AI_PHYSICAL_LEV = NUM_PHYSICAL_LEV + 1;
 static constexpr int AI_LEV = AI_PHYSICAL_LEV / VECTOR_SIZE;
 
+// Number of GLL columns in an element, remapped together in the vector lanes
+// by the column-vectorized kernel
+static constexpr int NUM_COLS = NP * NP;
+
 } // namespace _ppm_consts
 
 struct PpmBoundaryConditions {};
@@ -101,6 +105,31 @@ struct PpmMirrored : public PpmBoundaryConditions {
     }); // end ghost cell loop
   }
 
+  // Same as above, for all the columns of an element at once, with cell means
+  // stored with the column index fastest
+  KOKKOS_INLINE_FUNCTION
+  static void apply_ppm_boundary_cols(
+      ExecViewUnmanaged<const Real[_ppm_consts::AO_PHYSICAL_LEV][_ppm_consts::NUM_COLS]> /* cell_means */,
+      ExecViewUnmanaged<Real[3][NUM_PHYSICAL_LEV][_ppm_consts::NUM_COLS]> /* parabola_coeffs */)
+  {
+    // Nothing to do here
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void fill_cell_means_gs_cols(
+      const ExecViewUnmanaged<const Real[_ppm_consts::NUM_COLS][_ppm_consts::DPO_PHYSICAL_LEV]>&,
+      const ExecViewUnmanaged<Real[_ppm_consts::AO_PHYSICAL_LEV][_ppm_consts::NUM_COLS]>& cell_means) {
+    const int ip = _ppm_consts::INITIAL_PADDING;
+    for (int k_0 = 0; k_0 < _ppm_consts::gs; ++k_0) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < _ppm_consts::NUM_COLS; ++c) {
+        cell_means(ip - 1 - k_0, c) = cell_means(ip + k_0, c);
+        cell_means(ip + NUM_PHYSICAL_LEV + k_0, c) =
+            cell_means(ip + NUM_PHYSICAL_LEV - 1 - k_0, c);
+      }
+    }
+  }
+
   static constexpr const char *name() { return "Mirrored PPM"; }
 };
 
@@ -159,6 +188,46 @@ struct PpmLimitedExtrap : public PpmBoundaryConditions {
               lo, hi);
   }
 
+  // Same as above, for all the columns of an element at once, with cell means
+  // stored with the column index fastest
+  KOKKOS_INLINE_FUNCTION static void apply_ppm_boundary_cols (
+    const ExecViewUnmanaged<const Real[_ppm_consts::AO_PHYSICAL_LEV][_ppm_consts::NUM_COLS]>&,
+    const ExecViewUnmanaged<Real[3][NUM_PHYSICAL_LEV][_ppm_consts::NUM_COLS]>&)
+  {
+    // Nothing to do here
+  }
+
+  KOKKOS_INLINE_FUNCTION static void fill_cell_means_gs_cols (
+    const ExecViewUnmanaged<const Real[_ppm_consts::NUM_COLS][_ppm_consts::DPO_PHYSICAL_LEV]>& dpo,
+    const ExecViewUnmanaged<Real[_ppm_consts::AO_PHYSICAL_LEV][_ppm_consts::NUM_COLS]>& ao)
+  {
+    constexpr int ncol = _ppm_consts::NUM_COLS;
+    const int ip = _ppm_consts::INITIAL_PADDING, plev = NUM_PHYSICAL_LEV;
+
+    Real lo[ncol], hi[ncol];
+VECTOR_SIMD_LOOP
+    for (int c = 0; c < ncol; ++c) {
+      lo[c] = hi[c] = ao(ip,c);
+    }
+    for (int k = 1; k < plev; ++k) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        lo[c] = min(lo[c], ao(ip+k,c));
+        hi[c] = max(hi[c], ao(ip+k,c));
+      }
+    }
+
+VECTOR_SIMD_LOOP
+    for (int c = 0; c < ncol; ++c) {
+      linextrap(dpo(c,ip+1), dpo(c,ip), dpo(c,ip-1), dpo(c,ip-2),
+                ao(ip+1,c), ao(ip,c), ao(ip-1,c), ao(ip-2,c),
+                lo[c], hi[c]);
+      linextrap(dpo(c,ip+plev-2), dpo(c,ip+plev-1), dpo(c,ip+plev), dpo(c,ip+plev+1),
+                ao(ip+plev-2,c), ao(ip+plev-1,c), ao(ip+plev,c), ao(ip+plev+1,c),
+                lo[c], hi[c]);
+    }
+  }
+
   static constexpr const char* name () { return "PPM with limited extrapolation"; }
 };
 
@@ -201,6 +270,13 @@ struct PpmVertRemap : public VertRemapAlg {
   void compute_remap_phase(KernelVariables &kv,
                            ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> remap_var)
       const {
+    // With one thread per team, the vertical recurrences below leave the
+    // vector lanes idle, so remap all the columns at once instead
+    if ( ! OnGpu<ExecSpace>::value && kv.team.team_size() == 1) {
+      compute_remap_phase_cols(kv, remap_var);
+      return;
+    }
+
     // From here, we loop over tracers for only those portions which depend on
     // tracer data, which includes PPM limiting and mass accumulation
     // More parallelism than we need here, maybe break it up?
@@ -255,6 +331,128 @@ struct PpmVertRemap : public VertRemapAlg {
     kv.team_barrier();
   }
 
+  // Same as compute_remap_phase, for a team with a single thread. Each step is
+  // done for all the NP*NP columns of the element, with the column index in the
+  // innermost loop, so that the level recurrences (mass accumulation and
+  // integration) vectorize across columns. The workspace arrays are used with
+  // the column index fastest; the arithmetic is the same as the per-column
+  // path, so results are bitwise identical.
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_phase_cols(KernelVariables &kv,
+                                ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> remap_var)
+      const {
+    using namespace _ppm_consts;
+    constexpr int ncol = NUM_COLS;
+    constexpr int ip = INITIAL_PADDING;
+
+    // Per-element grids, with one column per row
+    const ExecViewUnmanaged<const Real[ncol][DPO_PHYSICAL_LEV]>
+      dpo(&m_dpo(kv.ie, 0, 0, 0));
+    const ExecViewUnmanaged<const Real[ncol][10][PPMDX_PHYSICAL_LEV]>
+      dx(&m_ppmdx(kv.ie, 0, 0, 0, 0));
+    const ExecViewUnmanaged<const int[ncol][NUM_PHYSICAL_LEV]>
+      k_id(&m_kid(kv.ie, 0, 0, 0));
+    const ExecViewUnmanaged<const Real[ncol][NUM_PHYSICAL_LEV]>
+      integral_bounds(&m_z2(kv.ie, 0, 0, 0));
+    assert(remap_var.span_is_contiguous());
+    const ExecViewUnmanaged<Real[ncol][NUM_LEV*VECTOR_SIZE]>
+      rvar(reinterpret_cast<Real*>(remap_var.data()));
+
+    // Workspace, with the column index fastest
+    const ExecViewUnmanaged<Real[AO_PHYSICAL_LEV][ncol]>
+      ao(&m_ao(kv.team_idx, 0, 0, 0));
+    const ExecViewUnmanaged<Real[MASS_O_PHYSICAL_LEV][ncol]>
+      mass_o(&m_mass_o(kv.team_idx, 0, 0, 0));
+    const ExecViewUnmanaged<Real[DMA_PHYSICAL_LEV][ncol]>
+      dma(&m_dma(kv.team_idx, 0, 0, 0));
+    const ExecViewUnmanaged<Real[AI_PHYSICAL_LEV][ncol]>
+      ai(&m_ai(kv.team_idx, 0, 0, 0));
+    const ExecViewUnmanaged<Real[3][NUM_PHYSICAL_LEV][ncol]>
+      parabola_coeffs(&m_parabola_coeffs(kv.team_idx, 0, 0, 0, 0));
+
+    // Cell means, and old mass accumulated up to the old interfaces
+VECTOR_SIMD_LOOP
+    for (int c = 0; c < ncol; ++c) {
+      mass_o(0, c) = 0;
+    }
+    for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        const Real v = rvar(c, k);
+        ao(k + ip, c) = v / dpo(c, k + ip);
+        mass_o(k + 1, c) = mass_o(k, c) + v;
+      }
+    }
+
+    boundaries::fill_cell_means_gs_cols(dpo, ao);
+
+    // Monotonic and conservative PPM reconstruction (see compute_ppm)
+    for (int j = 0; j < NUM_PHYSICAL_LEV + 2; ++j) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        const Real d1 = ao(j + ip, c) - ao(j + ip - 1, c);
+        const Real d0 = ao(j + ip - 1, c) - ao(j + ip - gs, c);
+        const Real da = dx(c, 0, j) * (dx(c, 1, j) * d1 + dx(c, 2, j) * d0);
+        dma(j, c) = d1 * d0 > 0.0 ?
+                    min(fabs(da), 2.0 * fabs(d0), 2.0 * fabs(d1)) * copysign(1.0, da) :
+                    0.0;
+      }
+    }
+
+    for (int j = 0; j < NUM_PHYSICAL_LEV + 1; ++j) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        const Real d1 = ao(j + ip, c) - ao(j + ip - 1, c);
+        ai(j, c) = ao(j + ip - 1, c) + dx(c, 3, j) * d1 +
+                   dx(c, 4, j) * (dx(c, 5, j) * (dx(c, 6, j) - dx(c, 7, j)) * d1 -
+                                  dx(c, 8, j) * dma(j + 1, c) + dx(c, 9, j) * dma(j, c));
+      }
+    }
+
+    for (int j = 0; j < NUM_PHYSICAL_LEV; ++j) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        const Real cm = ao(j + ip, c);
+        Real al = ai(j, c);
+        Real ar = ai(j + 1, c);
+        if ((ar - cm) * (cm - al) <= 0.) {
+          al = cm;
+          ar = cm;
+        }
+        if ((ar - al) * (cm - (al + ar) / 2.0) > (ar - al) * (ar - al) / 6.0) {
+          al = 3.0 * cm - 2.0 * ar;
+        }
+        if ((ar - al) * (cm - (al + ar) / 2.0) < -(ar - al) * (ar - al) / 6.0) {
+          ar = 3.0 * cm - 2.0 * al;
+        }
+        parabola_coeffs(0, j, c) = 1.5 * cm - (al + ar) / 4.0;
+        parabola_coeffs(1, j, c) = ar - al;
+        parabola_coeffs(2, j, c) = 3.0 * (-2.0 * cm + (al + ar));
+      }
+    }
+
+    boundaries::apply_ppm_boundary_cols(ao, parabola_coeffs);
+
+    // Integrate to the new interfaces (see compute_remap)
+    Real mass1[ncol];
+VECTOR_SIMD_LOOP
+    for (int c = 0; c < ncol; ++c) {
+      mass1[c] = 0;
+    }
+    for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+VECTOR_SIMD_LOOP
+      for (int c = 0; c < ncol; ++c) {
+        const int kk = k_id(c, k);
+        const Real mass2 = compute_mass(
+            parabola_coeffs(2, kk, c), parabola_coeffs(1, kk, c),
+            parabola_coeffs(0, kk, c), mass_o(kk, c),
+            dpo(c, kk + ip), integral_bounds(c, k));
+        rvar(c, k) = mass2 - mass1[c];
+        mass1[c] = mass2;
+      }
+    }
+  }
+
   KOKKOS_FORCEINLINE_FUNCTION
   Real compute_mass(const Real sq_coeff, const Real lin_coeff,
                     const Real const_coeff, const Real prev_mass,
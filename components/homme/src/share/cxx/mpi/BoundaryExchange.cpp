@@ -36,6 +36,31 @@ static void alloc3d (A& a, B& b, int ne, int a2, int b2) {
   b = ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_P]>**>("3d interface fields", ne, b2);
 }
 
+// The number of Reals in the buffer slot of a 3d field on a connection with npts
+// points. In single precision, two values are stored in each Real.
+static int slot_size_3d (const int npts, const int nlev, const bool single_prec) {
+  const int size = npts*nlev*VECTOR_SIZE;
+  return single_prec ? (size+1)/2 : size;
+}
+
+// Copy a per-field option to device, if some field does not use the default value.
+// Otherwise, clear the host vector and leave the device view empty, so that
+// pack/unpack can use the simpler code path.
+static void sync_field_option (std::vector<int>& h_opt, ExecViewManaged<int*>& d_opt,
+                               const int default_value, const std::string& name) {
+  bool needed = false;
+  for (const auto v : h_opt) needed = needed || (v != default_value);
+  if (needed) {
+    d_opt = ExecViewManaged<int*>(name, h_opt.size());
+    const auto h = Kokkos::create_mirror_view(d_opt);
+    for (size_t i = 0; i < h_opt.size(); ++i) h(i) = h_opt[i];
+    Kokkos::deep_copy(d_opt, h);
+  } else {
+    h_opt.clear();
+    d_opt = ExecViewManaged<int*>();
+  }
+}
+
 BoundaryExchange::BoundaryExchange()
 {
   m_num_1d_fields = 0;
@@ -48,6 +73,8 @@ BoundaryExchange::BoundaryExchange()
 
   m_num_elems = -1;
 
+  m_single_precision_wire = false;
+
   // Prohibit registration until the number of fields has been set
   m_registration_started   = false;
   m_registration_completed = false;
@@ -59,6 +86,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_local_pack_pending = false;
 
   m_diagnostics_level = 0;
 }
@@ -196,6 +224,17 @@ void BoundaryExchange::clean_up()
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
 
+  // Clear per-field options
+  m_3d_nlev_pack.clear();
+  m_3d_int_nlev_pack.clear();
+  m_3d_single_prec.clear();
+  m_3d_int_single_prec.clear();
+  m_3d_nlev_pack_d = decltype(m_3d_nlev_pack_d)();
+  m_3d_int_nlev_pack_d = decltype(m_3d_int_nlev_pack_d)();
+  m_3d_single_prec_d = decltype(m_3d_single_prec_d)();
+  m_3d_int_single_prec_d = decltype(m_3d_int_single_prec_d)();
+  m_single_precision_wire = false;
+
   // If we clean up, we need to reset the number of fields
   m_registration_started   = false;
   m_registration_completed = false;
@@ -227,36 +266,36 @@ void BoundaryExchange::registration_completed()
   // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
   //       we have 2 Real per level (max and min over element).
 
-  int single_ptr_buf_size = m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
-  for (int i = 0; i < m_num_3d_fields; ++i)
-    single_ptr_buf_size += m_3d_nlev_pack[i]*VECTOR_SIZE;
-  m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
-  m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
+  // Note: 3d fields may be exchanged on fewer levels, and/or in single precision.
+  assert (static_cast<int>(m_3d_nlev_pack.size()) == m_num_3d_fields &&
+          static_cast<int>(m_3d_single_prec.size()) == m_num_3d_fields);
+  assert (static_cast<int>(m_3d_int_nlev_pack.size()) == m_num_3d_int_fields &&
+          static_cast<int>(m_3d_int_single_prec.size()) == m_num_3d_int_fields);
+  for (int i = 0; i < m_num_3d_fields; ++i) {
+    Errors::runtime_check(m_3d_nlev_pack[i] <= NUM_LEV, "Optional nlev must be <= NUM_LEV");
+    Errors::runtime_check(m_3d_nlev_pack[i] > 0, "Optional nlev must be > 0");
+  }
+  for (int i = 0; i < m_num_3d_int_fields; ++i) {
+    Errors::runtime_check(m_3d_int_nlev_pack[i] <= NUM_LEV_P, "Optional nlev must be <= NUM_LEV_P");
+    Errors::runtime_check(m_3d_int_nlev_pack[i] > 0, "Optional nlev must be > 0");
+  }
+  for (const int kind : {etoi(ConnectionKind::CORNER), etoi(ConnectionKind::EDGE)}) {
+    const int npts = kind==etoi(ConnectionKind::EDGE) ? NP : 1;
+    m_elem_buf_size[kind] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + m_num_2d_fields*npts;
+    for (int i = 0; i < m_num_3d_fields; ++i)
+      m_elem_buf_size[kind] += slot_size_3d(npts, m_3d_nlev_pack[i], m_3d_single_prec[i]);
+    for (int i = 0; i < m_num_3d_int_fields; ++i)
+      m_elem_buf_size[kind] += slot_size_3d(npts, m_3d_int_nlev_pack[i], m_3d_int_single_prec[i]);
+  }
 
   // Determine what kind of BE is this (exchange or exchange_min_max)
   m_exchange_type = m_num_1d_fields>0 ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
 
-  // Finalize bookkeeping for any exchange on fewer than NUM_LEV levels.
-  {
-    bool need_nlev_pack = false;
-    for (int i = 0; i < m_num_3d_fields; ++i)
-      if (m_3d_nlev_pack[i] != NUM_LEV) {
-        Errors::runtime_check(m_3d_nlev_pack[i] < NUM_LEV,
-                              "Optional nlev must be <= NUM_LEV");
-        Errors::runtime_check(m_3d_nlev_pack[i] > 0,
-                              "Optional nlev must be > 0");
-        need_nlev_pack = true;
-        break;
-      }
-    if (need_nlev_pack) {
-      m_3d_nlev_pack_d = ExecViewManaged<int*>("m_3d_nlev_pack_d", m_3d_nlev_pack.size());
-      const auto h = Kokkos::create_mirror_view(m_3d_nlev_pack_d);
-      for (int i = 0; i < m_num_3d_fields; ++i) h(i) = m_3d_nlev_pack[i];
-      Kokkos::deep_copy(m_3d_nlev_pack_d, h);
-    }
-    // Clear the host vector if it's not needed.
-    if ( ! need_nlev_pack) m_3d_nlev_pack = decltype(m_3d_nlev_pack)();
-  }
+  // Finalize bookkeeping for any exchange on fewer than NUM_LEV(_P) levels, or in single precision.
+  sync_field_option(m_3d_nlev_pack, m_3d_nlev_pack_d, NUM_LEV, "m_3d_nlev_pack_d");
+  sync_field_option(m_3d_int_nlev_pack, m_3d_int_nlev_pack_d, NUM_LEV_P, "m_3d_int_nlev_pack_d");
+  sync_field_option(m_3d_single_prec, m_3d_single_prec_d, 0, "m_3d_single_prec_d");
+  sync_field_option(m_3d_int_single_prec, m_3d_int_single_prec_d, 0, "m_3d_int_single_prec_d");
 
   // Prohibit further registration of fields, and allow exchange
   m_registration_started   = false;
@@ -365,7 +404,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields,
+      const bool pack_local, const bool pack_shared) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +414,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      const bool shared = info.sharing == etoi(ConnectionSharing::SHARED);
+      if (shared ? !pack_shared : !pack_local)
+        return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -385,6 +428,22 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     });
 }
 
+// In a single precision slot, the entry (k, ilev) of a connection is stored as
+// VECTOR_SIZE floats, at float offset (k*nlev + ilev)*VECTOR_SIZE.
+KOKKOS_FORCEINLINE_FUNCTION
+static void pack_single (const ExecViewUnmanaged<Scalar**>& sb, const int k, const int ilev,
+                         const int nlev, const Scalar& val) {
+  float* const sbf = reinterpret_cast<float*>(sb.data()) + (k*nlev + ilev)*VECTOR_SIZE;
+  for (int v = 0; v < VECTOR_SIZE; ++v) sbf[v] = val[v];
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static void unpack_single (Scalar& val, const ExecViewUnmanaged<Scalar**>& rb, const int k,
+                           const int ilev, const int nlev) {
+  const float* const rbf = reinterpret_cast<const float*>(rb.data()) + (k*nlev + ilev)*VECTOR_SIZE;
+  for (int v = 0; v < VECTOR_SIZE; ++v) val[v] += rbf[v];
+}
+
 template <int NUM_LEV_PACKS, bool partial_column=false>
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -392,11 +451,15 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
       const int num_elems, const int num_3d_fields,
+      const bool pack_local, const bool pack_shared,
+      const ExecViewUnmanaged<const int*> single_prec,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  // If no field is sent in single precision, single_prec is empty
+  const bool any_single = single_prec.size() > 0;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     const int nconn = ucon.extent_int(0);
@@ -411,14 +474,23 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        const bool shared = info.sharing == etoi(ConnectionSharing::SHARED);
+        if (shared ? !pack_shared : !pack_local)
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
         const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
         const auto& sb = send_3d_buffers(ifield, buffer_iconn);
         const auto& f3 = fields_3d(info.local_lid, ifield);
-        for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
-          sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+        if (any_single && single_prec(ifield)) {
+          const int nlev = partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS;
+          for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
+            pack_single(sb, k, ilev, nlev, f3(pts[k].ip, pts[k].jp, ilev));
+        } else {
+          for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
+            sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+        }
       });
   } else {
     const auto num_parallel_iterations = num_elems*num_3d_fields;
@@ -436,12 +508,16 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         Homme::KernelVariables kv(team, num_3d_fields);
         const int ie = kv.ie;
         const int ifield = kv.iq;
-        const auto tvr = Kokkos::ThreadVectorRange(
-          kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
+        const int nlev = partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS;
+        const bool single = any_single && single_prec(ifield);
+        const auto tvr = Kokkos::ThreadVectorRange(kv.team, nlev);
         const int iconn_end = ucon_ptr(ie+1);
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          const bool shared = info.sharing == etoi(ConnectionSharing::SHARED);
+          if (shared ? !pack_shared : !pack_local)
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -452,9 +528,13 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           Kokkos::parallel_for(
             Kokkos::TeamThreadRange(kv.team, helpers.CONNECTION_SIZE[info.kind]),
             [&] (const int& k) {
-              auto* const sbp = &sb(k, 0);
               const auto* const f3p = &f3(pts[k].ip, pts[k].jp, 0);
-              Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] = f3p[ilev]; });
+              if (single) {
+                Kokkos::parallel_for(tvr, [&] (const int& ilev) { pack_single(sb, k, ilev, nlev, f3p[ilev]); });
+              } else {
+                auto* const sbp = &sb(k, 0);
+                Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] = f3p[ilev]; });
+              }
             });
         }
       });
@@ -464,6 +544,69 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 void BoundaryExchange::pack_and_send ()
 {
   tstart("be pack_and_send");
+  pack_and_send_impl(false);
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  tstart("be pack_and_send_shared");
+  pack_and_send_impl(true);
+  tstop("be pack_and_send_shared");
+}
+
+void BoundaryExchange::pack_local ()
+{
+  // Nothing was deferred if there are no fields (see pack_and_send_impl)
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  tstart("be pack_local");
+  // Must follow a call to pack_and_send_shared
+  assert (m_local_pack_pending);
+
+  pack_fields(true, false);
+  Kokkos::fence();
+
+  m_local_pack_pending = false;
+  tstop("be pack_local");
+}
+
+void BoundaryExchange::pack_fields (const bool pack_local, const bool pack_shared)
+{
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, pack 2d fields (if any)...
+  if (m_num_2d_fields > 0)
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+         m_num_2d_fields, pack_local, pack_shared);
+  // ...then pack 3d fields (if any)...
+  if (m_num_3d_fields > 0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                          m_num_elems, m_num_3d_fields, pack_local, pack_shared,
+                          m_3d_single_prec_d, &m_3d_nlev_pack_d);
+    else
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                    m_num_elems, m_num_3d_fields, pack_local, pack_shared,
+                    m_3d_single_prec_d);
+  }
+  // ...then pack 3d interface fields (if any)
+  if (m_num_3d_int_fields > 0) {
+    if (m_3d_int_nlev_pack_d.size() > 0)
+      pack<NUM_LEV_P, true>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                            m_num_elems, m_num_3d_int_fields, pack_local, pack_shared,
+                            m_3d_int_single_prec_d, &m_3d_int_nlev_pack_d);
+    else
+      pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                      m_num_elems, m_num_3d_int_fields, pack_local, pack_shared,
+                      m_3d_int_single_prec_d);
+  }
+}
+
+void BoundaryExchange::pack_and_send_impl (const bool defer_local)
+{
   // The registration MUST be completed by now
   // Note: this also implies connectivity and buffers manager are valid
   assert (m_registration_completed);
@@ -489,26 +632,17 @@ void BoundaryExchange::pack_and_send ()
     tstop("be build_buffer_views_and_requests");
   }
 
-  // ---- Pack ---- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
-  if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
-  // ...then pack 3d fields (if any)...
-  if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+  // If the local connections are deferred, the caller is going to do some
+  // work while the messages are in flight, so post the receives right away.
+  if (defer_local && !m_recv_pending) {
+    if ( ! m_recv_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                              m_connectivity->get_comm().mpi_comm());
+    m_recv_pending = true;
   }
-  // ...then pack 3d interface fields (if any)
-  if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+
+  // ---- Pack ---- //
+  pack_fields(!defer_local, true);
   Kokkos::fence();
 
   // ---- Send ---- //
@@ -522,7 +656,7 @@ void BoundaryExchange::pack_and_send ()
 
   // Notify a send is ongoing
   m_send_pending = true;
-  tstop("be pack_and_send");
+  m_local_pack_pending = defer_local;
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -583,11 +717,14 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> recv_3d_buffers,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
         const int num_elems, const int num_3d_fields,
+        const ExecViewUnmanaged<const int*> single_prec,
         ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  // If no field is sent in single precision, single_prec is empty
+  const bool any_single = single_prec.size() > 0;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     Kokkos::parallel_for(
@@ -602,18 +739,22 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         const int ie = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto iconn_beg = ucon_ptr(ie);
         const auto& f3 = fields_3d(ie, ifield);
+        const int nlev = partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS;
+        const bool single = any_single && single_prec(ifield);
+        const auto accumulate = [&] (Scalar& val, const ExecViewUnmanaged<Scalar**>& rb, const int k) {
+          if (single) unpack_single(val, rb, k, ilev, nlev);
+          else        val += rb(k, ilev);
+        };
         for (int k = 0; k < NP; ++k) {
           for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
             const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
-            f3(pts.ip, pts.jp, ilev) +=
-              recv_3d_buffers(ifield, iconn_beg + iedge)(k, ilev);
+            accumulate(f3(pts.ip, pts.jp, ilev), recv_3d_buffers(ifield, iconn_beg + iedge), k);
           }
         }
         const auto iconn_end = ucon_ptr(ie+1);
         for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
           const auto& pts = helpers.CONNECTION_PTS_FWD[ucon(iconn).local_dir][0];
-          f3(pts.ip, pts.jp, ilev) +=
-            recv_3d_buffers(ifield, iconn)(0, ilev);
+          accumulate(f3(pts.ip, pts.jp, ilev), recv_3d_buffers(ifield, iconn), 0);
         }
       });
     if (rspheremp) {
@@ -627,6 +768,10 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           const int i = (it / (NP*NUM_LEV_PACKS)) % NP;
           const int j = (it / NUM_LEV_PACKS) % NP;
           const int ilev = it % NUM_LEV_PACKS;
+          if (partial_column) { // compile out if !partial_column
+            if (ilev >= nlev_packs(ifield))
+              return;
+          }
           fields_3d(ie, ifield)(i, j, ilev) *= rsmp(ie, i, j);
         });
     }
@@ -639,15 +784,21 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         Homme::KernelVariables kv(team, num_3d_fields);
         const int ie = kv.ie;
         const int ifield = kv.iq;
-        const auto tvr = Kokkos::ThreadVectorRange(
-          kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
+        const int nlev = partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS;
+        const bool single = any_single && single_prec(ifield);
+        const auto tvr = Kokkos::ThreadVectorRange(kv.team, nlev);
         const auto& f3 = fields_3d(ie, ifield);
         const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
+        const auto accumulate = [&] (Scalar* const f3p, const ExecViewUnmanaged<Scalar**>& r3, const int k) {
+          if (single) {
+            Kokkos::parallel_for(tvr, [&] (const int& ilev) { unpack_single(f3p[ilev], r3, k, ilev, nlev); });
+          } else {
+            const auto* const r3p = &r3(k, 0);
+            Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          }
+        };
         const auto ef = [&] (const int& iedge, const int& k, const int& ip, const int& jp) {
-          const auto& r3 = recv_3d_buffers(ifield, iconn_beg + iedge);
-          auto* const f3p = &f3(ip, jp, 0);
-          const auto* const r3p = &r3(k, 0);
-          Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          accumulate(&f3(ip, jp, 0), recv_3d_buffers(ifield, iconn_beg + iedge), k);
         };
         for (int k = 0; k < NP; ++k) {
           ef(0, k, 0,    k   );
@@ -661,8 +812,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           auto* const f3p = &f3(helpers.CONNECTION_PTS_FWD[dir][0].ip,
                                 helpers.CONNECTION_PTS_FWD[dir][0].jp, 0);
           assert(r3.size() > 0);
-          const auto* const r3p = &r3(0, 0);
-          Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          accumulate(f3p, r3, 0);
         }
         if (rspheremp) {
           for (int i = 0; i < NP; ++i)
@@ -706,6 +856,9 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
                               m_connectivity->get_comm().mpi_comm());
     m_recv_pending = true;
   }
+
+  // If the local connections were deferred, they must be packed by now
+  assert (!m_local_pack_pending);
   tstop("be recv_and_unpack book");
 
   // ---- Recv ---- //
@@ -732,15 +885,21 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   if (m_num_3d_fields>0) {
     if (m_3d_nlev_pack_d.size() > 0)
       unpack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
-                            m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+                            m_num_elems, m_num_3d_fields, m_3d_single_prec_d, &m_3d_nlev_pack_d);
     else
       unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
-                      m_num_elems, m_num_3d_fields);
+                      m_num_elems, m_num_3d_fields, m_3d_single_prec_d);
   }
   // ...then unpack 3d interface fields (if any).
-  if (m_num_3d_int_fields > 0)
-    unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
-                      m_num_elems, m_num_3d_int_fields);
+  if (m_num_3d_int_fields > 0) {
+    if (m_3d_int_nlev_pack_d.size() > 0)
+      unpack<NUM_LEV_P, true>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
+                              m_num_elems, m_num_3d_int_fields, m_3d_int_single_prec_d,
+                              &m_3d_int_nlev_pack_d);
+    else
+      unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
+                        m_num_elems, m_num_3d_int_fields, m_3d_int_single_prec_d);
+  }
   Kokkos::fence();
 
   // If another BE structure starts an exchange, it has no way to check that
@@ -1007,6 +1166,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
 
   assert (m_3d_nlev_pack.empty() ||
           static_cast<int>(m_3d_nlev_pack.size()) == m_num_3d_fields);
+  assert (m_3d_int_nlev_pack.empty() ||
+          static_cast<int>(m_3d_int_nlev_pack.size()) == m_num_3d_int_fields);
 
   // We want to set the send/recv buffers to point to:
   //   - a portion of send/recv_buffer if info.sharing=SHARED
@@ -1016,6 +1177,7 @@ void BoundaryExchange::build_buffer_views_and_requests()
   //   - increment[CORNER]  = m_elem_buf_size[CORNER)] = 1  * (m_num_2d_fields + NUM_LEV*VECTOR_SIZE m_num_3d_fields)
   //   - increment[EDGE]    = m_elem_buf_size[EDGE)]   = NP * (m_num_2d_fields + NUM_LEV*VECTOR_SIZE m_num_3d_fields)
   //   - increment[MISSING] = 0 (point to the same blackhole)
+  // (3d fields exchanged on fewer levels, or in single precision, use less; see slot_size_3d)
 
   HostViewManaged<size_t[3]> h_buf_offset("");
   Kokkos::deep_copy(h_buf_offset, 0);
@@ -1093,24 +1255,28 @@ void BoundaryExchange::build_buffer_views_and_requests()
         recv_buffer.get() + h_buf_offset[info.sharing], helpers.CONNECTION_SIZE[info.kind]);
       h_buf_offset[info.sharing] += h_increment_2d[info.kind];
     }
+    // Note: in single precision, only the start of the slot is used by pack/unpack
     for (int f = 0; f < m_num_3d_fields; ++f) {
       const auto nlev_3d = m_3d_nlev_pack.empty() ? NUM_LEV : m_3d_nlev_pack[f];
+      const bool single_prec = !m_3d_single_prec.empty() && m_3d_single_prec[f];
       h_send_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
         reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], nlev_3d);
       h_recv_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
         reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], nlev_3d);
-      h_buf_offset[info.sharing] += h_increment_3d[info.kind]*nlev_3d*VECTOR_SIZE;
+      h_buf_offset[info.sharing] += slot_size_3d(h_increment_3d[info.kind], nlev_3d, single_prec);
     }
     for (int f = 0; f < m_num_3d_int_fields; ++f) {
+      const auto nlev_3d = m_3d_int_nlev_pack.empty() ? NUM_LEV_P : m_3d_int_nlev_pack[f];
+      const bool single_prec = !m_3d_int_single_prec.empty() && m_3d_int_single_prec[f];
       h_send_3d_int_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
         reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
-        helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
+        helpers.CONNECTION_SIZE[info.kind], nlev_3d);
       h_recv_3d_int_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
         reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
-        helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
-      h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV_P*VECTOR_SIZE;
+        helpers.CONNECTION_SIZE[info.kind], nlev_3d);
+      h_buf_offset[info.sharing] += slot_size_3d(h_increment_3d[info.kind], nlev_3d, single_prec);
     }
   }
   Kokkos::deep_copy(m_send_1d_buffers, h_send_1d_buffers);
@@ -85,6 +85,15 @@ class MpiBuffersManager;
  *  - the Connectivity must be set BEFORE any call to set_num_fields
  *  - the BM must be set BEFORE any call to registration_completed
  *
+ * The amount of data sent for each 3d field can be reduced in two ways:
+ *
+ *  - the optional nlev argument of register_field, which exchanges only the
+ *    first nlev packs of the field (e.g., the last pack of an interface field
+ *    that is reset after the exchange anyway);
+ *  - set_single_precision_wire(true), after which the registered 3d fields are
+ *    sent as 32-bit floats. This halves their message size, but it is not BFB
+ *    with the default, so use it only for quantities that can tolerate it.
+ *
  */
 
 class BoundaryExchange
@@ -112,6 +121,10 @@ public:
   // Clean up MPI stuff and registered fields (but leaves connectivity and buffers manager)
   void clean_up ();
 
+  // If true, 3d fields registered from now on are sent in single precision.
+  // The values are accumulated in double precision upon unpacking.
+  void set_single_precision_wire (const bool single_precision) { m_single_precision_wire = single_precision; }
+
   // Check whether fields registration has already started/finished
   bool is_registration_started   () const { return m_registration_started;   }
   bool is_registration_completed () const { return m_registration_completed; }
@@ -139,8 +152,8 @@ public:
   template<typename... Properties>
   void register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Properties...> field, int idim_out, int num_dims, int start_dim, int nlev=NUM_LEV);
 
-  // Handle both NUM_LEV and NUM_LEV_P. register_field does not support nlev !=
-  // NUM_LEV_P.
+  // Handle both NUM_LEV and NUM_LEV_P. For interface fields, nlev can be at
+  // most NUM_LEV_P.
   template<int NUM_LEV_IN, typename... Properties>
   void register_field (ExecView<Scalar*[NP][NP][NUM_LEV_IN], Properties...> field, int nlev=NUM_LEV_IN) {
     register_field_impl<NUM_LEV_IN,Properties...>(field,nlev);
@@ -219,6 +232,13 @@ public:
   void pack_and_send ();
   void recv_and_unpack ();
 
+  // Split version of pack_and_send, to overlap communication with computation.
+  // pack_and_send_shared packs and sends only the connections shared with other
+  // ranks (so only halo elements need to be up to date), while pack_local packs
+  // the on-rank connections. The caller must call pack_local before recv_and_unpack.
+  void pack_and_send_shared ();
+  void pack_local ();
+
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
   void recv_and_unpack_min_max ();
@@ -277,15 +297,25 @@ private:
 
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_send_3d_buffers;
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_recv_3d_buffers;
-  
-  // TODO: optimize: you only need to pack/unpack the first entry of the NUM_LEV_P-th pack.
-  //       This is because, if NUM_LEV!=NUM_LEV_P, then the NUM_LEV_P-th pack contains
-  //       only one meaningful value (the rest is garbage, most likely nan's).
+
+  // Note: if NUM_LEV!=NUM_LEV_P, the NUM_LEV_P-th pack contains only one meaningful
+  //       value. If that value is not needed by the neighbors, register the field
+  //       with nlev=NUM_LEV, so that the last pack is not exchanged at all.
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>  m_send_3d_int_buffers;
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>  m_recv_3d_int_buffers;  
 
   std::vector<int> m_3d_nlev_pack;        // during registration
   ExecViewManaged<int*> m_3d_nlev_pack_d; //  after registration
+  std::vector<int> m_3d_int_nlev_pack;
+  ExecViewManaged<int*> m_3d_int_nlev_pack_d;
+
+  // Whether each 3d field is sent in single precision. As for the nlev packs,
+  // the device views are empty if no field needs them.
+  bool m_single_precision_wire;
+  std::vector<int> m_3d_single_prec;
+  ExecViewManaged<int*> m_3d_single_prec_d;
+  std::vector<int> m_3d_int_single_prec;
+  ExecViewManaged<int*> m_3d_int_single_prec_d;
 
   // The number of registered fields
   int         m_num_1d_fields;    // Without counting the 2x factor due to min/max fields
@@ -301,6 +331,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_local_pack_pending;
 
   int         m_num_elems;
 
@@ -311,6 +342,8 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  void pack_and_send_impl(const bool defer_local);
+  void pack_fields(const bool pack_local, const bool pack_shared);
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
@@ -439,7 +472,10 @@ void BoundaryExchange::register_field (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][
     });
   }
 
-  for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  for (int i = 0; i < num_dims; ++i) {
+    m_3d_nlev_pack.push_back(nlev);
+    m_3d_single_prec.push_back(m_single_precision_wire);
+  }
   m_num_3d_fields += num_dims;
 }
 
@@ -464,7 +500,10 @@ void BoundaryExchange::register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Prop
     });
   }
 
-  for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  for (int i = 0; i < num_dims; ++i) {
+    m_3d_nlev_pack.push_back(nlev);
+    m_3d_single_prec.push_back(m_single_precision_wire);
+  }
   m_num_3d_fields += num_dims;
 }
 
@@ -492,6 +531,7 @@ void BoundaryExchange::register_field_impl (
   }
 
   m_3d_nlev_pack.push_back(nlev);
+  m_3d_single_prec.push_back(m_single_precision_wire);
   ++m_num_3d_fields;
 }
 
@@ -509,10 +549,6 @@ void BoundaryExchange::register_field_impl (
   assert (m_num_3d_int_fields+1<=m_3d_int_fields.extent_int(1));
   assert (m_num_1d_fields==0);
 
-  Errors::runtime_check(
-    nlev == NUM_LEV_IN,
-    "register_field for 3D interface fields does not support nlev < NUM_LEV_P.");
-
   {
     auto l_num_3d_int_fields = m_num_3d_int_fields;
     auto l_3d_int_fields = m_3d_int_fields;
@@ -522,6 +558,8 @@ void BoundaryExchange::register_field_impl (
     });
   }
 
+  m_3d_int_nlev_pack.push_back(nlev);
+  m_3d_int_single_prec.push_back(m_single_precision_wire);
   ++m_num_3d_int_fields;
 }
 
@@ -568,7 +606,10 @@ void BoundaryExchange::register_field_impl (
       f);
   }
 
-  for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  for (int i = 0; i < num_dims; ++i) {
+    m_3d_nlev_pack.push_back(nlev);
+    m_3d_single_prec.push_back(m_single_precision_wire);
+  }
   m_num_3d_fields += num_dims;
 }
 
@@ -585,23 +626,23 @@ void BoundaryExchange::register_field_impl (
   assert (m_registration_started && !m_registration_completed);
   assert (num_dims>0 && start_dim>=0);
   assert (start_dim+num_dims<=field.extent_int(1));
-  assert (m_num_3d_int_fields+1<=m_3d_int_fields.extent_int(1));
+  assert (m_num_3d_int_fields+num_dims<=m_3d_int_fields.extent_int(1));
   assert (m_num_1d_fields==0);
 
-  Errors::runtime_check(
-    nlev == NUM_LEV_IN,
-    "register_field for 3D interface fields does not support nlev < NUM_LEV_P.");
-
   {
     auto l_num_3d_int_fields = m_num_3d_int_fields;
     auto l_3d_int_fields = m_3d_int_fields;
     Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
-      l_3d_int_fields(ie, l_num_3d_int_fields) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL, ALL);
+      l_3d_int_fields(ie, l_num_3d_int_fields+idim) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL, ALL);
     });
   }
 
-  ++m_num_3d_int_fields;
+  for (int i = 0; i < num_dims; ++i) {
+    m_3d_int_nlev_pack.push_back(nlev);
+    m_3d_int_single_prec.push_back(m_single_precision_wire);
+  }
+  m_num_3d_int_fields += num_dims;
 }
 
 // --- min-max fields --- //
@@ -313,6 +313,35 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::get_halo_and_interior_elements (std::vector<int>& halo, std::vector<int>& interior) const
+{
+  // Connections are only set up in finalize
+  assert (m_finalized);
+
+  halo.clear();
+  interior.clear();
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool shared = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k)
+      shared = shared || h_ucon(k).sharing == etoi(ConnectionSharing::SHARED);
+    (shared ? halo : interior).push_back(ie);
+  }
+}
+
+int Connectivity::get_halo_first_elements (ExecViewManaged<int*>& elems) const
+{
+  std::vector<int> halo, interior;
+  get_halo_and_interior_elements(halo,interior);
+
+  elems = ExecViewManaged<int*>("halo first elems",m_num_local_elements);
+  auto h_elems = Kokkos::create_mirror_view(elems);
+  std::copy(halo.begin(),halo.end(),h_elems.data());
+  std::copy(interior.begin(),interior.end(),h_elems.data()+halo.size());
+  Kokkos::deep_copy(elems,h_elems);
+
+  return halo.size();
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
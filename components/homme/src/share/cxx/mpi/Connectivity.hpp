@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -122,6 +124,15 @@ public:
   KOKKOS_INLINE_FUNCTION
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
+  // Split the local elements in halo elements (with at least one connection
+  // shared with another rank) and interior elements (all the others).
+  void get_halo_and_interior_elements (std::vector<int>& halo, std::vector<int>& interior) const;
+
+  // Same as above, but store the halo elements followed by the interior elements
+  // in a single device view (of size num_local_elements), as needed by functors
+  // that overlap boundary exchanges with computation. Returns the number of halo elements.
+  int get_halo_first_elements (ExecViewManaged<int*>& elems) const;
+
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
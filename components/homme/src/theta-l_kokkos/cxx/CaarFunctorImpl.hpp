@@ -93,6 +93,15 @@ struct CaarFunctorImpl {
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
 
+  // If true, pack and send halo elements data before computing interior elements.
+  // Default is set by the HOMMEXX_CAAR_OVERLAP_EXCHANGE cmake option.
+  bool                  m_overlap_exchange;
+  // Local ids of the halo elements, followed by those of the interior elements.
+  ExecViewManaged<int*> m_overlap_elems;
+  int                   m_num_halo_elems;
+  // Where the TagPreExchangeSubset kernel starts reading m_overlap_elems
+  int                   m_overlap_offset;
+
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
   ElementsDerivedState  m_derived;
@@ -104,6 +113,7 @@ struct CaarFunctorImpl {
   SphereOperators       m_sphere_ops;
 
   struct TagPreExchange {};
+  struct TagPreExchangeSubset {};
   struct TagPostExchange {};
 
   // Policies
@@ -131,6 +141,13 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+#ifdef HOMMEXX_CAAR_OVERLAP_EXCHANGE
+      , m_overlap_exchange(true)
+#else
+      , m_overlap_exchange(false)
+#endif
+      , m_num_halo_elems(0)
+      , m_overlap_offset(0)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +171,13 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+#ifdef HOMMEXX_CAAR_OVERLAP_EXCHANGE
+      , m_overlap_exchange(true)
+#else
+      , m_overlap_exchange(false)
+#endif
+      , m_num_halo_elems(0)
+      , m_overlap_offset(0)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -315,16 +339,22 @@ struct CaarFunctorImpl {
       be.register_field(m_state.m_dp3d,1,tl);
       if (!m_theta_hydrostatic_mode) {
         // Note: phinh_i at the surface (last level) is constant, so it doesn't *need* bex.
-        //       If bex(constant)=constant, we might just do it. This would not eliminate
-        //       the need for halo-exchange of interface-based quantities though, since
-        //       we would still need to exchange w_i.
+        //       If NUM_LEV!=NUM_LEV_P, the last pack only contains the surface value,
+        //       so skip it, and reset phi_surf=phis after the exchange (see TagPostExchange).
+        //       This would not eliminate the need for halo-exchange of interface-based
+        //       quantities though, since we would still need to exchange w_i.
         be.register_field(m_state.m_w_i,1,tl);
-        be.register_field(m_state.m_phinh_i,1,tl);
+        be.register_field(m_state.m_phinh_i,1,tl,NUM_LEV);
       }
       be.registration_completed();
     }
+
+    // Halo elements are the only ones whose data is sent to other ranks.
+    m_num_halo_elems = bm_exchange->get_connectivity()->get_halo_first_elements(m_overlap_elems);
   }
 
+  void set_overlap_exchange (const bool overlap) { m_overlap_exchange = overlap; }
+
   void set_rk_stage_data (const RKStageData& data) {
     m_data = data;
 
@@ -345,18 +375,22 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_overlap_exchange) {
+      run_pre_exchange_overlapped(data);
+    } else {
+      GPTLstart("caar compute");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -370,12 +404,80 @@ struct CaarFunctorImpl {
     profiling_pause();
   }
 
+  // Same as the TagPreExchange loop followed by the exchange, but the shared
+  // connections are packed and sent as soon as the halo elements are done, so
+  // that MPI messages are in flight while the interior elements are computed.
+  // The pre-exchange computation is element-local, so results are BFB.
+  void run_pre_exchange_overlapped (const RKStageData& data)
+  {
+    assert (m_overlap_elems.extent_int(0)==m_num_elems);
+    auto& be = *m_bes[data.np1];
+    const int num_interior_elems = m_num_elems - m_num_halo_elems;
+
+    GPTLstart("caar compute");
+    int nerr = 0;
+    if (m_num_halo_elems>0) {
+      m_overlap_offset = 0;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (halo)",
+                              get_subset_policy(m_num_halo_elems), *this, nerr);
+      Kokkos::fence();
+    }
+    GPTLstop("caar compute");
+
+    GPTLstart("caar_bexchV");
+    be.pack_and_send_shared();
+    GPTLstop("caar_bexchV");
+
+    GPTLstart("caar compute");
+    if (num_interior_elems>0) {
+      int nerr_interior;
+      m_overlap_offset = m_num_halo_elems;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (interior)",
+                              get_subset_policy(num_interior_elems), *this, nerr_interior);
+      Kokkos::fence();
+      nerr += nerr_interior;
+    }
+    GPTLstop("caar compute");
+
+    GPTLstart("caar_bexchV");
+    const ExecViewUnmanaged<const Real*[NP][NP]> rspheremp = m_geometry.m_rspheremp;
+    be.pack_local();
+    be.recv_and_unpack(&rspheremp);
+    Kokkos::fence();
+    GPTLstop("caar_bexchV");
+
+    // Checking after the exchange, so we don't leave messages pending on abort
+    if (nerr > 0)
+      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+  }
+
+  // Use the same threads/vectors distribution of m_policy_pre, since m_tu
+  // (and therefore the workspace slots) was built from it.
+  TeamPolicyType<TagPreExchangeSubset> get_subset_policy (const int num_elems) const {
+    const auto threads_vectors =
+      DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+    TeamPolicyType<TagPreExchangeSubset> policy(num_elems,threads_vectors.first,threads_vectors.second);
+    policy.set_chunk_size(1);
+    return policy;
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
-    // In this body, we use '====' to separate sync epochs (delimited by barriers)
-    // Note: make sure the same temp is not used within each epoch!
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv, nerr);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPreExchangeSubset&, const TeamMember &team, int& nerr) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_overlap_elems(m_overlap_offset + team.league_rank());
+    compute_pre_exchange(kv, nerr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (KernelVariables& kv, int& nerr) const {
+    // In this body, we use '====' to separate sync epochs (delimited by barriers)
+    // Note: make sure the same temp is not used within each epoch!
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -461,11 +563,10 @@ struct CaarFunctorImpl {
     u -= m_data.scale1*m_data.dt*(dpnh_dp_i-1.0)*phis_x/2.0;
     v -= m_data.scale1*m_data.dt*(dpnh_dp_i-1.0)*phis_y/2.0;
 
-    // TODO: you need to modify the BoundaryExchange class a bit, cause as of today
-    //       it exchanges *all* vertical levels. For phi, we don't want/need to
-    //       exchange the last level, since phi=phis at surface.
-    //       So to make sure we're not messing up, set phi back to phis on last interface
-    // Note: this is *independent* of whether NUM_LEV==NUM_LEV_P or not.
+    // For phi, we don't want/need to exchange the last level, since phi=phis at surface.
+    // If NUM_LEV!=NUM_LEV_P, the last pack is not exchanged at all, while otherwise
+    // the last level is exchanged with the rest of its pack. Either way, set phi
+    // back to phis on last interface.
     auto& phi_surf = m_state.m_phinh_i(ie,m_data.np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END];
     phi_surf = m_geometry.m_phis(ie,igp,jgp);
 
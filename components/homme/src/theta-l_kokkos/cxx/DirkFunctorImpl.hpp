@@ -30,7 +30,7 @@ struct DirkFunctorImpl {
   enum : int { max_num_lev_pack = NUM_LEV_P };
   enum : int { num_lev_aligned = max_num_lev_pack*packn };
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
-  enum : int { num_work = 12 };
+  enum : int { num_work = 13 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
 
   enum : int {
@@ -41,6 +41,19 @@ struct DirkFunctorImpl {
 #endif
   };
 
+  enum : int {
+#ifdef HOMMEXX_DIRK_MODIFIED_NEWTON
+    default_modified_newton = true
+#else
+    default_modified_newton = false
+#endif
+  };
+
+  // Mask for the column packs the Newton iteration works on.
+  struct AllActive {
+    KOKKOS_INLINE_FUNCTION bool operator() (const int) const { return true; }
+  };
+
   static_assert(num_lev_aligned >= 3,
                 "We use wrk(0:2,:) and so need num_lev_aligned >= 3");
 
@@ -138,13 +151,15 @@ struct DirkFunctorImpl {
 
   void run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
             const Elements& e, const HybridVCoord& hvcoord,
-            const bool bfb_solver = default_bfb_solver) {
+            const bool bfb_solver = default_bfb_solver,
+            const bool modified_newton = default_modified_newton) {
     if ( ! calc_initial_guess_in_newton_kernel) {
       run_initial_guess(np1, e, hvcoord);
       Kokkos::fence();
     }
 
-    run_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+    run_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver,
+               modified_newton);
     Kokkos::fence();
   }
 
@@ -199,8 +214,14 @@ struct DirkFunctorImpl {
     Kokkos::parallel_for(m_ig_policy, toplevel);
   }
 
+  // Unless bfb_solver is true, columns stop iterating once their own Newton
+  // increment is below tolerance, rather than when the slowest column of the
+  // element converges. If modified_newton is true (and bfb_solver is false),
+  // the factorized Jacobian is reused across iterations, and recomputed only
+  // when convergence stalls.
   void run_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
-                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) {
+                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver,
+                   const bool modified_newton = default_modified_newton) {
     using Kokkos::subview;
     using Kokkos::parallel_for;
     const auto a = Kokkos::ALL();
@@ -213,6 +234,9 @@ struct DirkFunctorImpl {
 #else
     const Real deltatol = 1e-11; // exit if newton increment < deltatol
 #endif
+    // In modified Newton, refactor the Jacobian if the Newton increment
+    // decreases by less than this factor in one iteration.
+    const Real refactor_ratio = 0.1;
 
     const auto work = m_work;
     const auto ls = m_ls;
@@ -226,6 +250,8 @@ struct DirkFunctorImpl {
     const auto e_initial_guess = e.m_derived.m_divdp_proj;
     const auto hybi = hvcoord.hybrid_bi;
     const auto tu   = m_tu;
+    const bool mask_columns = ! bfb_solver;
+    const bool reuse_jacobian = modified_newton && ! bfb_solver;
 
     const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
       KernelVariables kv(team, tu);
@@ -245,7 +271,8 @@ struct DirkFunctorImpl {
       dp3d      = get_work_slot(work, kv.team_idx,  8),
       pnh       = get_work_slot(work, kv.team_idx,  9),
       wrk       = get_work_slot(work, kv.team_idx, 10),
-      xfull     = get_work_slot(work, kv.team_idx, 11);
+      xfull     = get_work_slot(work, kv.team_idx, 11),
+      conv      = get_work_slot(work, kv.team_idx, 12);
       const auto
       dl = get_ls_slot(ls, kv.team_idx, 0),
       d  = get_ls_slot(ls, kv.team_idx, 1),
@@ -339,20 +366,43 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
+      // conv(0,i)[s] is 1 while column s of pack i iterates; conv(1,i)[0] is 1
+      // while any column of pack i does.
+      init_active_columns(kv, nvec, conv);
+      kv.team_barrier();
+      const auto active = [&] (const int i) {
+        return ! mask_columns || conv(1,i)[0] != 0;
+      };
+
       int it = 0;
-      Real deltaerr;
+      Real deltaerr, deltaerr_prev = 0;
+      bool refactor = true;
       for (; it < maxiter; ++it) { // Newton iteration
         const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
-                                               dphi, pnh, wrk, dpnh_dp_i);
+                                               dphi, pnh, wrk, dpnh_dp_i,
+                                               nlev, active);
         if ( ! ok) nerr = 1;
         kv.team_barrier();
         loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
-          x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
+          if (active(i))
+            x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
+          else
+            x(k,i) = 0; // a converged pack gets a zero increment
         });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
-        kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        if (reuse_jacobian) {
+          if (refactor) {
+            calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+            kv.team_barrier();
+            factor(kv, nvec, dl, d, du);
+            kv.team_barrier();
+          }
+          solve_factored(kv, nvec, dl, d, du, x);
+        } else {
+          calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+          kv.team_barrier();
+          if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        }
         kv.team_barrier();
 
         loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
@@ -378,6 +428,16 @@ struct DirkFunctorImpl {
         loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
 
         if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+
+        if (reuse_jacobian) {
+          refactor = it > 0 && deltaerr > refactor_ratio*deltaerr_prev;
+          deltaerr_prev = deltaerr;
+        }
+        if (mask_columns) {
+          kv.team_barrier();
+          calc_active_columns(kv, nlev, nvec, wmax, deltatol, x, conv);
+          kv.team_barrier();
+        }
       } // Newton iteration
       kv.team_barrier();
 
@@ -553,7 +613,7 @@ struct DirkFunctorImpl {
     parallel_for(TeamThreadRange(kv.team, nlev-1), f2);
   }
 
-  template <typename R, typename W, typename Wi>
+  template <typename R, typename W, typename Wi, typename Active = AllActive>
   KOKKOS_INLINE_FUNCTION
   static bool pnh_and_exner_from_eos (
     const KernelVariables& kv, const HybridVCoord& hvcoord,
@@ -561,7 +621,9 @@ struct DirkFunctorImpl {
     const R& vtheta_dp, const R& dp3d, const R& dphi,
     // exner is workspace. dpnh_dp_i(nlevp,:) is not computed.
     const W& pnh, const W& exner, const Wi& dpnh_dp_i,
-    const int nlev = NUM_PHYSICAL_LEV)
+    const int nlev = NUM_PHYSICAL_LEV,
+    // Packs i for which active(i) is false are skipped.
+    const Active& active = Active())
   {
     using Kokkos::parallel_for;
 
@@ -572,6 +634,7 @@ struct DirkFunctorImpl {
     // Compute pnh(1:nlev,:). pnh(nlevp,:) is not needed.
     const auto f1 = [&] (const int k) {
       const auto g = [&] (const int i) {
+        if ( ! active(i)) return;
         for (int s = 0; s < ns; ++s)
           if (vtheta_dp(k,i)[s] < 0 || dphi(k,i)[s] > 0) ok = false;
         EquationOfState::compute_pnh_and_exner(
@@ -586,6 +649,7 @@ struct DirkFunctorImpl {
     kv.team_barrier(); // wait for pnh
     const auto f2 = [&] (const int) {
       const auto k0 = [&] (const int i) {
+        if ( ! active(i)) return;
         const auto pnh_i_0 = hvcoord.hybrid_ai0*hvcoord.ps0; // hydrostatic ptop
         dpnh_dp_i(0,i) = 2*(pnh(0,i) - pnh_i_0)/dp3d(0,i);
       };
@@ -597,6 +661,7 @@ struct DirkFunctorImpl {
       // gnu and std=c++14. The macro ConstExceptGnu is defined in share/cxx/Config.hpp.
       ConstExceptGnu auto k = km1 + 1;
       const auto kr = [&] (const int i) {
+        if ( ! active(i)) return;
         dpnh_dp_i(k,i) = ((pnh(k,i) - pnh(k-1,i))/
                           ((dp3d(k-1,i) + dp3d(k,i))/2));
       };
@@ -787,6 +852,74 @@ struct DirkFunctorImpl {
     scream::tridiag::bfb(kv.team, dl, d, du, x);
   }
 
+  // Factorize the tridiagonal matrices in place, one column pack per vector
+  // lane, for use in any number of subsequent calls to solve_factored. As
+  // noted in calc_jacobian, no pivoting is needed.
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void factor (const KernelVariables& kv, const int nvec,
+                      const W& dl, const W& d, const W& du) {
+    const int nlev = d.extent_int(0);
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int k = 1; k < nlev; ++k) {
+        dl(k,i) /= d(k-1,i);
+        d (k,i) -= dl(k,i)*du(k-1,i);
+      }
+    });
+  }
+
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void solve_factored (const KernelVariables& kv, const int nvec,
+                              const W& dl, const W& d, const W& du, const W& x) {
+    const int nlev = d.extent_int(0);
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int k = 1; k < nlev; ++k)
+        x(k,i) -= dl(k,i)*x(k-1,i);
+      x(nlev-1,i) /= d(nlev-1,i);
+      for (int k = nlev-1; k > 0; --k)
+        x(k-1,i) = (x(k-1,i) - du(k-1,i)*x(k,i))/d(k-1,i);
+    });
+  }
+
+  // Mark all columns as active. Padding entries of the last pack are inactive.
+  KOKKOS_INLINE_FUNCTION static void
+  init_active_columns (const KernelVariables& kv, const int nvec, const WorkSlot& conv) {
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int s = 0; s < packn; ++s)
+        conv(0,i)[s] = (i*packn + s < scaln) ? 1 : 0;
+      conv(1,i) = 1;
+    });
+  }
+
+  // Deactivate the columns whose Newton increment satisfies the same criterion
+  // as exit_on_step, and the packs all of whose columns are inactive.
+  KOKKOS_INLINE_FUNCTION static void
+  calc_active_columns (const KernelVariables& kv, const int nlev, const int nvec,
+                       const Real& wmax, const Real& deltatol,
+                       const LinearSystemSlot& x, const WorkSlot& conv) {
+    using Kokkos::parallel_reduce;
+    using Kokkos::parallel_for;
+    using Kokkos::TeamThreadRange;
+    using Kokkos::ThreadVectorRange;
+    const auto f = [&] (int idx) {
+      const int i = idx / packn, s = idx % packn;
+      if (conv(0,i)[s] == 0) return;
+      const auto g = [&] (int k, Real& lmaxval) { lmaxval = max(lmaxval, std::abs(x(k,i)[s])); };
+      Real maxval;
+      const auto vr = ThreadVectorRange(kv.team, nlev);
+      parallel_reduce(vr, g, Kokkos::Max<Real>(maxval));
+      if (maxval/wmax < deltatol) conv(0,i)[s] = 0;
+    };
+    parallel_for(TeamThreadRange(kv.team, static_cast<int>(scaln)), f);
+    kv.team_barrier();
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      Real any = 0;
+      for (int s = 0; s < packn; ++s) any = max(any, conv(0,i)[s]);
+      conv(1,i)[0] = any;
+    });
+  }
+
   // Determine a step length 0 < alpha <= 1.
   KOKKOS_INLINE_FUNCTION static void
   calc_step_size (const KernelVariables& kv, const int nlev, const int nvec,
@@ -37,6 +37,18 @@ HyperviscosityFunctorImpl (const SimulationParams&     params,
  , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
  , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
  , m_tu(m_policy_update_states)
+#ifdef HOMMEXX_HV_SINGLE_PRECISION_EXCHANGE
+ , m_single_precision_lap_exchange(true)
+#else
+ , m_single_precision_lap_exchange(false)
+#endif
+#ifdef HOMMEXX_HV_OVERLAP_EXCHANGE
+ , m_overlap_exchange(true)
+#else
+ , m_overlap_exchange(false)
+#endif
+ , m_num_halo_elems(0)
+ , m_overlap_offset(0)
 {
   init_params(params);
 
@@ -57,6 +69,18 @@ HyperviscosityFunctorImpl (const int num_elems, const SimulationParams &params)
   , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
   , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
   , m_tu(m_policy_update_states)
+#ifdef HOMMEXX_HV_SINGLE_PRECISION_EXCHANGE
+  , m_single_precision_lap_exchange(true)
+#else
+  , m_single_precision_lap_exchange(false)
+#endif
+#ifdef HOMMEXX_HV_OVERLAP_EXCHANGE
+  , m_overlap_exchange(true)
+#else
+  , m_overlap_exchange(false)
+#endif
+  , m_num_halo_elems(0)
+  , m_overlap_offset(0)
 {
   init_params(params);
 }
@@ -202,9 +226,13 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
   m_be_tom = std::make_shared<BoundaryExchange>();
   m_be->set_label("Hyperviscosity-std");
   m_be_tom->set_label("Hyperviscosity-TOM");
-  std::shared_ptr<BoundaryExchange> bes[] = {m_be, m_be_tom};
-  const int nlevs[] = {NUM_LEV, m_nu_scale_top_ilev_pack_lim};
-  for (int i = 0; i < 2; ++i) {
+  // The first laplacian is only an intermediate quantity, so it can be exchanged
+  // in single precision, which halves the size of the messages (not BFB).
+  m_be_lap = std::make_shared<BoundaryExchange>();
+  m_be_lap->set_label("Hyperviscosity-lap");
+  std::shared_ptr<BoundaryExchange> bes[] = {m_be, m_be_tom, m_be_lap};
+  const int nlevs[] = {NUM_LEV, m_nu_scale_top_ilev_pack_lim, NUM_LEV};
+  for (int i = 0; i < 3; ++i) {
     if (i == 1 && m_data.nu_top <= 0) continue;
     auto be = bes[i];
     be->set_diagnostics_level(sp.internal_diagnostics_level);
@@ -215,6 +243,7 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     } else {
       be->set_num_fields(0, 0, 4);
     }
+    be->set_single_precision_wire(i == 2);
     be->register_field(m_buffers.dptens, nlev);
     be->register_field(m_buffers.ttens, nlev);
     if (m_process_nh_vars) {
@@ -224,8 +253,52 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     be->register_field(m_buffers.vtens, 2, 0, nlev);
     be->registration_completed();
   }
+
+  // Halo elements are the only ones whose data is sent to other ranks.
+  m_num_halo_elems = bm_exchange->get_connectivity()->get_halo_first_elements(m_overlap_elems);
 }//initBE
 
+template<typename Tag>
+void HyperviscosityFunctorImpl::
+run_overlapped (BoundaryExchange& be,
+                const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  assert (m_overlap_elems.extent_int(0)==m_num_elems);
+  assert (be.is_registration_completed());
+  const int num_interior_elems = m_num_elems - m_num_halo_elems;
+
+  // Use the same threads/vectors distribution of the full policies, since m_tu
+  // (and therefore the workspace slots) was built from them.
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+  const auto subset_policy = [&] (const int num_elems) {
+    Kokkos::TeamPolicy<ExecSpace,Tag> policy(num_elems,threads_vectors.first,threads_vectors.second);
+    policy.set_chunk_size(1);
+    return policy;
+  };
+
+  if (m_num_halo_elems>0) {
+    m_overlap_offset = 0;
+    Kokkos::parallel_for(subset_policy(m_num_halo_elems), *this);
+    Kokkos::fence();
+  }
+
+  GPTLstart("hvf-bexch");
+  be.pack_and_send_shared();
+  GPTLstop("hvf-bexch");
+
+  if (num_interior_elems>0) {
+    m_overlap_offset = m_num_halo_elems;
+    Kokkos::parallel_for(subset_policy(num_interior_elems), *this);
+    Kokkos::fence();
+  }
+
+  GPTLstart("hvf-bexch");
+  be.pack_local();
+  be.recv_and_unpack(rspheremp);
+  GPTLstop("hvf-bexch");
+}
+
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
 {
   m_data.np1 = np1;
@@ -271,14 +344,18 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
+    if (m_overlap_exchange) {
+      run_overlapped<TagHyperPreExchangeSubset>(*m_be, nullptr);
+    } else {
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
 
-    // Exchange
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+      // Exchange
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -350,19 +427,26 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   } // for sponge layer
 } // run()
 
-void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
+void HyperviscosityFunctorImpl::biharmonic_wk_theta()
 {
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
+  auto& be_lap = m_single_precision_lap_exchange ? *m_be_lap : *m_be;
+  if (m_overlap_exchange) {
+    // The first laplacian is element-local, so this is BFB with the branch below
+    const ExecViewUnmanaged<const Real*[NP][NP]> rspheremp = m_geometry.m_rspheremp;
+    run_overlapped<TagFirstLaplaceHVSubset>(be_lap, &rspheremp);
+  } else {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
 
-  // Exchange
-  assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+    // Exchange
+    assert (be_lap.is_registration_completed());
+    GPTLstart("hvf-bexch");
+    be_lap.exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  }
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
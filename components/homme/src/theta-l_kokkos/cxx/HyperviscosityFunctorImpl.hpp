@@ -85,6 +85,9 @@ public:
   struct TagHyperPreExchange {};
   struct TagNutopUpdateStates {};
   struct TagNutopLaplace {};
+  // Same as TagFirstLaplaceHV and TagHyperPreExchange, on a subset of the elements
+  struct TagFirstLaplaceHVSubset {};
+  struct TagHyperPreExchangeSubset {};
 
   HyperviscosityFunctorImpl (const SimulationParams&     params,
                              const ElementsGeometry&     geometry,
@@ -105,14 +108,33 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
-  void biharmonic_wk_theta () const;
+  void biharmonic_wk_theta ();
+
+  void set_overlap_exchange (const bool overlap) { m_overlap_exchange = overlap; }
+
+  // If true, exchange the first laplacian in single precision (not BFB).
+  void set_single_precision_lap_exchange (const bool single_precision) {
+    m_single_precision_lap_exchange = single_precision;
+  }
 
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagFirstLaplaceHV&, const TeamMember& team) const {
-     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+    KernelVariables kv(team, m_tu);
+    compute_first_laplace(kv);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagFirstLaplaceHVSubset&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_overlap_elems(m_overlap_offset + team.league_rank());
+    compute_first_laplace(kv);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_first_laplace (KernelVariables& kv) const {
+     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -313,9 +335,21 @@ public:
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagHyperPreExchange, const TeamMember &team) const {
-    using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagHyperPreExchangeSubset, const TeamMember &team) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_overlap_elems(m_overlap_offset + team.league_rank());
+    compute_pre_exchange(kv);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (KernelVariables& kv) const {
+    using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -386,6 +420,12 @@ public:
 
 protected:
 
+  // Run the kernel for Tag (a *Subset tag) on the halo elements, send their
+  // data, then run it on the interior elements while the messages are in flight.
+  template<typename Tag>
+  void run_overlapped (BoundaryExchange& be,
+                       const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+
   const int             m_num_elems;
   HyperviscosityData    m_data;
   ElementsState         m_state;
@@ -410,6 +450,20 @@ protected:
   TeamUtils<ExecSpace> m_tu; // If the policies only differ by tag, just need one tu
 
   std::shared_ptr<BoundaryExchange> m_be, m_be_tom;
+  // Exchanges the first laplacian in single precision. Used instead of m_be
+  // if m_single_precision_lap_exchange is true.
+  std::shared_ptr<BoundaryExchange> m_be_lap;
+  // Default is set by HOMMEXX_HV_SINGLE_PRECISION_EXCHANGE.
+  bool                              m_single_precision_lap_exchange;
+
+  // If true, compute and send halo elements before computing interior elements,
+  // for both exchanges of each subcycle. Default is set by HOMMEXX_HV_OVERLAP_EXCHANGE.
+  bool                  m_overlap_exchange;
+  // Local ids of the halo elements, followed by those of the interior elements.
+  ExecViewManaged<int*> m_overlap_elems;
+  int                   m_num_halo_elems;
+  // Where the *Subset kernels start reading m_overlap_elems
+  int                   m_overlap_offset;
 
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
   int m_nu_scale_top_ilev_pack_lim;
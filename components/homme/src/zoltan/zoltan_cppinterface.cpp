@@ -145,8 +145,10 @@ void zoltan_partition_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // The weights are given for the global graph; pass those of the local rows.
+  const zgno_t wgtBegin = numMyElements > 0 ? myBegin : 0;
+  ia->setEdgeWeights(adjwgt + xadj[wgtBegin], 1, 0);
+  ia->setVertexWeights(vwgt + wgtBegin, 1, 0);
   /***********************************SET COORDINATES*********************/
 
 
@@ -345,8 +347,10 @@ void zoltan_map_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // The weights are given for the global graph; pass those of the local rows.
+  const zgno_t wgtBegin = numMyElements > 0 ? myBegin : 0;
+  ia->setEdgeWeights(adjwgt + xadj[wgtBegin], 1, 0);
+  ia->setVertexWeights(vwgt + wgtBegin, 1, 0);
 
   env->timerStop(Zoltan2::MACRO_TIMERS, "AdapterCreate");
   /***********************************SET COORDINATES*********************/
@@ -505,8 +509,10 @@ void zoltan_mapping_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // The weights are given for the global graph; pass those of the local rows.
+  const zgno_t wgtBegin = numMyElements > 0 ? myBegin : 0;
+  ia->setEdgeWeights(adjwgt + xadj[wgtBegin], 1, 0);
+  ia->setVertexWeights(vwgt + wgtBegin, 1, 0);
 
   env->timerStop(Zoltan2::MACRO_TIMERS, "AdapterCreate");
   /***********************************SET COORDINATES*********************/
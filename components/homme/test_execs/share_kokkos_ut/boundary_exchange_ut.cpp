@@ -11,6 +11,7 @@
 
 #include <random>
 #include <iomanip>
+#include <cmath>
 
 using namespace Homme;
 
@@ -301,6 +302,124 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Split pack: packing the connections shared with other ranks first (and starting
+  // the sends), and the on-rank connections later, must be BFB with pack_and_send.
+  {
+    ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> f_whole("", num_elements), f_split("", num_elements);
+    auto f_whole_host = Kokkos::create_mirror_view(f_whole);
+    auto f_split_host = Kokkos::create_mirror_view(f_split);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+            for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+              f_whole_host(ie,igp,jgp,ilev)[ivec] = dreal(engine);
+    }}}}}
+    Kokkos::deep_copy(f_split_host, f_whole_host);
+    Kokkos::deep_copy(f_whole, f_whole_host);
+    Kokkos::deep_copy(f_split, f_split_host);
+
+    auto be_whole = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_whole->set_num_fields(0,0,1);
+    be_whole->register_field(f_whole);
+    be_whole->registration_completed();
+
+    auto be_split = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_split->set_num_fields(0,0,1);
+    be_split->register_field(f_split);
+    be_split->registration_completed();
+
+    be_whole->pack_and_send();
+    be_whole->recv_and_unpack();
+
+    be_split->pack_and_send_shared();
+    be_split->pack_local();
+    be_split->recv_and_unpack();
+
+    Kokkos::deep_copy(f_whole_host, f_whole);
+    Kokkos::deep_copy(f_split_host, f_split);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+            for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+              REQUIRE(f_split_host(ie,igp,jgp,ilev)[ivec]==f_whole_host(ie,igp,jgp,ilev)[ivec]);
+    }}}}}
+
+    be_whole->clean_up();
+    be_split->clean_up();
+  }
+
+  // Reduced wire format: a single precision exchange must match the double precision
+  // one up to float roundoff, and an interface field registered with nlev=NUM_LEV must
+  // leave its last pack untouched.
+  {
+    constexpr double single_prec_tolerance = 1e-6;
+    ExecViewManaged<Scalar*[NP][NP][NUM_LEV]>   f_dp ("", num_elements), f_sp ("", num_elements);
+    ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> fi_dp("", num_elements), fi_sp("", num_elements);
+    auto f_dp_host  = Kokkos::create_mirror_view(f_dp);
+    auto f_sp_host  = Kokkos::create_mirror_view(f_sp);
+    auto fi_dp_host = Kokkos::create_mirror_view(fi_dp);
+    auto fi_sp_host = Kokkos::create_mirror_view(fi_sp);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+            for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+              if (ilev<NUM_LEV) {
+                f_dp_host(ie,igp,jgp,ilev)[ivec] = dreal(engine);
+              }
+              fi_dp_host(ie,igp,jgp,ilev)[ivec] = dreal(engine);
+    }}}}}
+    Kokkos::deep_copy(f_sp_host,  f_dp_host);
+    Kokkos::deep_copy(fi_sp_host, fi_dp_host);
+    Kokkos::deep_copy(f_dp,  f_dp_host);
+    Kokkos::deep_copy(f_sp,  f_sp_host);
+    Kokkos::deep_copy(fi_dp, fi_dp_host);
+    Kokkos::deep_copy(fi_sp, fi_sp_host);
+
+    auto be_dp = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_dp->set_num_fields(0,0,1,1);
+    be_dp->register_field(f_dp);
+    be_dp->register_field(fi_dp);
+    be_dp->registration_completed();
+
+    auto be_sp = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_sp->set_num_fields(0,0,1,1);
+    be_sp->set_single_precision_wire(true);
+    be_sp->register_field(f_sp);
+    be_sp->register_field(fi_sp,NUM_LEV);
+    be_sp->registration_completed();
+
+    // Keep a copy of the original fi, to check that its last pack is not exchanged.
+    // NOTE: use create_mirror, since on host builds a mirror view aliases fi_sp.
+    auto fi_orig_host = Kokkos::create_mirror(fi_sp);
+    Kokkos::deep_copy(fi_orig_host, fi_sp);
+
+    be_dp->exchange();
+    be_sp->exchange();
+
+    Kokkos::deep_copy(f_dp_host,  f_dp);
+    Kokkos::deep_copy(f_sp_host,  f_sp);
+    Kokkos::deep_copy(fi_dp_host, fi_dp);
+    Kokkos::deep_copy(fi_sp_host, fi_sp);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+            for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+              if (ilev<NUM_LEV) {
+                REQUIRE(std::abs(f_dp_host(ie,igp,jgp,ilev)[ivec]-f_sp_host(ie,igp,jgp,ilev)[ivec]) < single_prec_tolerance);
+                REQUIRE(std::abs(fi_dp_host(ie,igp,jgp,ilev)[ivec]-fi_sp_host(ie,igp,jgp,ilev)[ivec]) < single_prec_tolerance);
+              } else {
+                REQUIRE(fi_sp_host(ie,igp,jgp,ilev)[ivec]==fi_orig_host(ie,igp,jgp,ilev)[ivec]);
+              }
+    }}}}}
+
+    be_dp->clean_up();
+    be_sp->clean_up();
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <random>
+#include <cstring>
 
 #include "Types.hpp"
 #include "Context.hpp"
@@ -39,6 +40,21 @@ void run_limiter_f90 (const int& np1, Real*& dp_ptr, Real*& vtheta_dp_ptr);
 void cleanup_f90();
 } // extern "C"
 
+// Host copy of a (device) view, which never aliases the input view
+template<typename ViewT>
+typename ViewT::HostMirror host_copy (const ViewT& v) {
+  auto h = Kokkos::create_mirror(v);
+  Kokkos::deep_copy(h,v);
+  return h;
+}
+
+// Check that a view has the same bits as a previous host copy of it
+template<typename ViewT>
+bool same_bits (const ViewT& v, const typename ViewT::HostMirror& h_ref) {
+  auto h = host_copy(v);
+  return std::memcmp(h.data(),h_ref.data(),h.span()*sizeof(typename ViewT::value_type))==0;
+}
+
 TEST_CASE("caar", "caar_testing") {
 
   // Catch runs these blocks of code multiple times, namely once per each
@@ -439,6 +455,105 @@ TEST_CASE("caar", "caar_testing") {
     }
   }
 
+  SECTION ("caar_overlap") {
+    for (const bool hydrostatic : {true,false}) {
+      if (comm.root()) {
+        std::cout << " -> " << (hydrostatic ? "Hydrostatic\n" : "Non-Hydrostatic\n");
+      }
+      for (int rsplit : {3,0}) {
+        if (comm.root()) {
+          std::cout << "  -> rsplit = " << rsplit << "\n";
+        }
+        params.theta_hydrostatic_mode = hydrostatic;
+        params.theta_adv_form = AdvectionForm::NonConservative;
+        params.rsplit = rsplit;
+
+        // Generate RK stage data
+        Real dt = RPDF(1.0,10.0)(engine);
+        Real eta_ave_w = RPDF(0.1,1.0)(engine);
+        Real scale1 = RPDF(1.0,2.0)(engine);
+        Real scale2 = RPDF(1.0,2.0)(engine);
+        Real scale3 = RPDF(1.0,2.0)(engine);
+
+        int  np1 = IPDF(0,2)(engine);
+
+        auto mpi_comm = Context::singleton().get<Comm>().mpi_comm();
+        MPI_Bcast(&dt,1,MPI_DOUBLE,0,mpi_comm);
+        MPI_Bcast(&scale1,1,MPI_DOUBLE,0,mpi_comm);
+        MPI_Bcast(&scale2,1,MPI_DOUBLE,0,mpi_comm);
+        MPI_Bcast(&scale3,1,MPI_DOUBLE,0,mpi_comm);
+        MPI_Bcast(&eta_ave_w,1,MPI_DOUBLE,0,mpi_comm);
+        MPI_Bcast(&np1,1,MPI_INT,0,mpi_comm);
+
+        const int  n0  = (np1+1)%3;
+        const int  nm1 = (np1+2)%3;
+
+        RKStageData data (nm1, n0, np1, 0, dt, eta_ave_w, scale1, scale2, scale3);
+
+        // Randomize state/derived, and save the inputs
+        elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+        elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+
+        auto& state   = elems.m_state;
+        auto& derived = elems.m_derived;
+        const auto v_in            = host_copy(state.m_v);
+        const auto w_in            = host_copy(state.m_w_i);
+        const auto vtheta_in       = host_copy(state.m_vtheta_dp);
+        const auto phi_in          = host_copy(state.m_phinh_i);
+        const auto dp3d_in         = host_copy(state.m_dp3d);
+        const auto vn0_in          = host_copy(derived.m_vn0);
+        const auto eta_dot_dpdn_in = host_copy(derived.m_eta_dot_dpdn);
+        const auto omega_p_in      = host_copy(derived.m_omega_p);
+
+        // Create the Caar functor
+        CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+        FunctorsBuffersManager fbm;
+        fbm.request_size( caar.requested_buffer_size() );
+        fbm.request_size(limiter.requested_buffer_size());
+        fbm.allocate();
+        caar.init_buffers(fbm);
+        limiter.init_buffers(fbm);
+        caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+        // Plain run: compute all elements, then exchange
+        caar.set_overlap_exchange(false);
+        caar.run(data);
+
+        const auto v_plain            = host_copy(state.m_v);
+        const auto w_plain            = host_copy(state.m_w_i);
+        const auto vtheta_plain       = host_copy(state.m_vtheta_dp);
+        const auto phi_plain          = host_copy(state.m_phinh_i);
+        const auto dp3d_plain         = host_copy(state.m_dp3d);
+        const auto vn0_plain          = host_copy(derived.m_vn0);
+        const auto eta_dot_dpdn_plain = host_copy(derived.m_eta_dot_dpdn);
+        const auto omega_p_plain      = host_copy(derived.m_omega_p);
+
+        // Restore the inputs, and run again, overlapping the exchange with the
+        // interior elements computation. This must be BFB with the plain run.
+        Kokkos::deep_copy(state.m_v,              v_in);
+        Kokkos::deep_copy(state.m_w_i,            w_in);
+        Kokkos::deep_copy(state.m_vtheta_dp,      vtheta_in);
+        Kokkos::deep_copy(state.m_phinh_i,        phi_in);
+        Kokkos::deep_copy(state.m_dp3d,           dp3d_in);
+        Kokkos::deep_copy(derived.m_vn0,          vn0_in);
+        Kokkos::deep_copy(derived.m_eta_dot_dpdn, eta_dot_dpdn_in);
+        Kokkos::deep_copy(derived.m_omega_p,      omega_p_in);
+
+        caar.set_overlap_exchange(true);
+        caar.run(data);
+
+        REQUIRE (same_bits(state.m_v,              v_plain));
+        REQUIRE (same_bits(state.m_w_i,            w_plain));
+        REQUIRE (same_bits(state.m_vtheta_dp,      vtheta_plain));
+        REQUIRE (same_bits(state.m_phinh_i,        phi_plain));
+        REQUIRE (same_bits(state.m_dp3d,           dp3d_plain));
+        REQUIRE (same_bits(derived.m_vn0,          vn0_plain));
+        REQUIRE (same_bits(derived.m_eta_dot_dpdn, eta_dot_dpdn_plain));
+        REQUIRE (same_bits(derived.m_omega_p,      omega_p_plain));
+      }
+    }
+  }
+
   SECTION ("limiter_dp3d") {
 
     // rsplit and hydro_mode are irrelevant for this test, so just pick something
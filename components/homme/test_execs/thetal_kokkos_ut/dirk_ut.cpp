@@ -762,9 +762,10 @@ TEST_CASE ("dirk_toplevel_testing") {
     const int nm1 = alphadtwt_nm1 == 0.0 ? -1 : 0;
     for (Real alphadtwt_n0 : {0.0, 0.7}) {
       decltype(ElementsState::m_w_i) w_i("w_i", nelemd),
-        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
+        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd), w_i3("w_i3", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
-        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd),
+        phinh_i3("phinh_i3", nelemd);
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -819,7 +820,7 @@ TEST_CASE ("dirk_toplevel_testing") {
 
         // Run C++ with non-BFB solver.
         d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
-              e, hvcoord, false /* non-BFB solver */);
+              e, hvcoord, false /* non-BFB solver */, false /* full Newton */);
         fence();
         deep_copy(w_i1, e.m_state.m_w_i);
         deep_copy(phinh_i1, e.m_state.m_phinh_i);
@@ -827,6 +828,16 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with non-BFB solver and Jacobian reuse.
+        d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+              e, hvcoord, false /* non-BFB solver */, true /* modified Newton */);
+        fence();
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
         break;
       }
 
@@ -836,6 +847,8 @@ TEST_CASE ("dirk_toplevel_testing") {
       const auto w2m = cmvdc(w_i2);
       const auto phinh1m = cmvdc(phinh_i1);
       const auto phinh2m = cmvdc(phinh_i2);
+      const auto w3m = cmvdc(w_i3);
+      const auto phinh3m = cmvdc(phinh_i3);
 
       // Test that running with BFB and non-BFB solvers produces similar answers.
       for (int ie = 0; ie < nelemd; ++ie)
@@ -848,6 +861,17 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that full and modified Newton produce similar answers.
+      for (int ie = 0; ie < nelemd; ++ie)
+        for (int i = 0; i < np; ++i)
+          for (int j = 0; j < np; ++j)
+            for (int f = 0; f < 2; ++f) {
+              Real* p1 = f == 0 ? &w1m(ie,np1,i,j,0)[0] : &phinh1m(ie,np1,i,j,0)[0];
+              Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+              for (int k = 0; k < nlev+1; ++k)
+                REQUIRE(almost_equal(p1[k], p3[k], 1e6*eps));
+            }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);
@@ -930,6 +930,8 @@ TEST_CASE ("gllfvremap_testing") {
     test_remapds(s.r, 11,  7, 13);
     test_remapds(s.r, 16,  4,  8);
     test_remapds(s.r,  4, 16,  8);
+    // Enough levels for full and partial level blocks in small_gemm.
+    test_remapds(s.r, 16,  4, 72);
 
     // Limiter.
     for (const auto too_tight : {false, true}) {
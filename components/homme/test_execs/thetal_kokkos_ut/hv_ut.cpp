@@ -1,5 +1,8 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <random>
 
 #include "Types.hpp"
@@ -57,6 +60,41 @@ void cleanup_f90();
 // using this instead of HVF we can access protected members
 // of HVF (e.g., for initialization) without exposing them in HVF.
 
+// Host copy of a (device) view, which never aliases the input view
+template<typename ViewT>
+typename ViewT::HostMirror host_copy (const ViewT& v) {
+  auto h = Kokkos::create_mirror(v);
+  Kokkos::deep_copy(h,v);
+  return h;
+}
+
+// Check that a view has the same bits as a previous host copy of it
+template<typename ViewT>
+bool same_bits (const ViewT& v, const typename ViewT::HostMirror& h_ref) {
+  auto h = host_copy(v);
+  return std::memcmp(h.data(),h_ref.data(),h.span()*sizeof(typename ViewT::value_type))==0;
+}
+
+// Max abs difference between a view and a previous host copy of it, relative
+// to the max abs value of the copy
+template<typename ViewT>
+Real rel_diff (const ViewT& v, const typename ViewT::HostMirror& h_ref) {
+  auto h = host_copy(v);
+  const int n = h.span()*sizeof(typename ViewT::value_type)/sizeof(Real);
+  const Real* a = reinterpret_cast<const Real*>(h.data());
+  const Real* b = reinterpret_cast<const Real*>(h_ref.data());
+  Real diff = 0, ref = 0;
+  for (int i=0; i<n; ++i) {
+    diff = std::max(diff,std::abs(a[i]-b[i]));
+    ref  = std::max(ref,std::abs(b[i]));
+  }
+  return ref>0 ? diff/ref : diff;
+}
+
+// Tolerance for the single precision exchange of the first laplacian: float
+// roundoff, amplified by the second laplacian.
+constexpr Real single_prec_lap_tol = 1e-4;
+
 class HVFTester : public HyperviscosityFunctorImpl {
 public:
   HVFTester (const SimulationParams&     params,
@@ -312,7 +350,43 @@ TEST_CASE("hvf", "biharmonic") {
         // Set the hv scaling
         hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
 
-        // Run kokkos version
+        // Run kokkos version, with the plain double precision exchange
+        hvf.set_single_precision_lap_exchange(false);
+        hvf.set_overlap_exchange(false);
+        hvf.biharmonic_wk_theta();
+        const auto dptens_plain  = host_copy(hvf.get_dptens());
+        const auto ttens_plain   = host_copy(hvf.get_ttens());
+        const auto wtens_plain   = host_copy(hvf.get_wtens());
+        const auto phitens_plain = host_copy(hvf.get_phitens());
+        const auto vtens_plain   = host_copy(hvf.get_vtens());
+
+        // Run again on the same state, overlapping the exchange with the
+        // interior elements computation. This must be BFB with the plain run.
+        hvf.set_overlap_exchange(true);
+        hvf.biharmonic_wk_theta();
+        REQUIRE (same_bits(hvf.get_dptens(),dptens_plain));
+        REQUIRE (same_bits(hvf.get_ttens(),ttens_plain));
+        REQUIRE (same_bits(hvf.get_vtens(),vtens_plain));
+        if (hvf.process_nh_vars()) {
+          REQUIRE (same_bits(hvf.get_wtens(),wtens_plain));
+          REQUIRE (same_bits(hvf.get_phitens(),phitens_plain));
+        }
+
+        // Run again, exchanging the first laplacian in single precision. This is
+        // not BFB, but must match the double precision run up to a tolerance.
+        hvf.set_single_precision_lap_exchange(true);
+        hvf.set_overlap_exchange(false);
+        hvf.biharmonic_wk_theta();
+        REQUIRE (rel_diff(hvf.get_dptens(),dptens_plain) < single_prec_lap_tol);
+        REQUIRE (rel_diff(hvf.get_ttens(),ttens_plain) < single_prec_lap_tol);
+        REQUIRE (rel_diff(hvf.get_vtens(),vtens_plain) < single_prec_lap_tol);
+        if (hvf.process_nh_vars()) {
+          REQUIRE (rel_diff(hvf.get_wtens(),wtens_plain) < single_prec_lap_tol);
+          REQUIRE (rel_diff(hvf.get_phitens(),phitens_plain) < single_prec_lap_tol);
+        }
+
+        // Go back to double precision, for the comparison with fortran
+        hvf.set_single_precision_lap_exchange(false);
         hvf.biharmonic_wk_theta();
 
         // Run fortran version
@@ -580,9 +654,65 @@ TEST_CASE("hvf", "biharmonic") {
         // Set the viscosity params
         hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
 
-        // Run the cxx functor
+        // Run the cxx functor with the plain exchange
+        const auto v_in      = host_copy(state.m_v);
+        const auto w_in      = host_copy(state.m_w_i);
+        const auto vtheta_in = host_copy(state.m_vtheta_dp);
+        const auto dp_in     = host_copy(state.m_dp3d);
+        const auto phinh_in  = host_copy(state.m_phinh_i);
+
+        hvf.set_single_precision_lap_exchange(false);
+        hvf.set_overlap_exchange(false);
         hvf.run(np1,dt,eta_ave_w);
 
+        const auto v_plain      = host_copy(state.m_v);
+        const auto w_plain      = host_copy(state.m_w_i);
+        const auto vtheta_plain = host_copy(state.m_vtheta_dp);
+        const auto dp_plain     = host_copy(state.m_dp3d);
+        const auto phinh_plain  = host_copy(state.m_phinh_i);
+
+        // Restore the input states, and run again, overlapping both exchanges of
+        // each subcycle with the interior elements computation. Must be BFB.
+        Kokkos::deep_copy(state.m_v,         v_in);
+        Kokkos::deep_copy(state.m_w_i,       w_in);
+        Kokkos::deep_copy(state.m_vtheta_dp, vtheta_in);
+        Kokkos::deep_copy(state.m_dp3d,      dp_in);
+        Kokkos::deep_copy(state.m_phinh_i,   phinh_in);
+
+        hvf.set_overlap_exchange(true);
+        hvf.run(np1,dt,eta_ave_w);
+
+        REQUIRE (same_bits(state.m_v,         v_plain));
+        REQUIRE (same_bits(state.m_w_i,       w_plain));
+        REQUIRE (same_bits(state.m_vtheta_dp, vtheta_plain));
+        REQUIRE (same_bits(state.m_dp3d,      dp_plain));
+        REQUIRE (same_bits(state.m_phinh_i,   phinh_plain));
+
+        // Restore the input states, and run again, exchanging the first laplacian
+        // in single precision. Must match the double precision run up to a tolerance.
+        Kokkos::deep_copy(state.m_v,         v_in);
+        Kokkos::deep_copy(state.m_w_i,       w_in);
+        Kokkos::deep_copy(state.m_vtheta_dp, vtheta_in);
+        Kokkos::deep_copy(state.m_dp3d,      dp_in);
+        Kokkos::deep_copy(state.m_phinh_i,   phinh_in);
+
+        hvf.set_single_precision_lap_exchange(true);
+        hvf.set_overlap_exchange(false);
+        hvf.run(np1,dt,eta_ave_w);
+
+        REQUIRE (rel_diff(state.m_v,         v_plain)      < single_prec_lap_tol);
+        REQUIRE (rel_diff(state.m_w_i,       w_plain)      < single_prec_lap_tol);
+        REQUIRE (rel_diff(state.m_vtheta_dp, vtheta_plain) < single_prec_lap_tol);
+        REQUIRE (rel_diff(state.m_dp3d,      dp_plain)     < single_prec_lap_tol);
+        REQUIRE (rel_diff(state.m_phinh_i,   phinh_plain)  < single_prec_lap_tol);
+
+        // Put back the double precision results, for the comparison with fortran
+        Kokkos::deep_copy(state.m_v,         v_plain);
+        Kokkos::deep_copy(state.m_w_i,       w_plain);
+        Kokkos::deep_copy(state.m_vtheta_dp, vtheta_plain);
+        Kokkos::deep_copy(state.m_dp3d,      dp_plain);
+        Kokkos::deep_copy(state.m_phinh_i,   phinh_plain);
+
         // Run the f90 functor
         advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic,
                              dp_ref_ptr, theta_ref_ptr, phi_ref_ptr,